@@ -0,0 +1,176 @@
+/*
+
+ This sketch tests the MKR NB 1500 board's asynchronous TCP client.
+ It starts a non blocking connection to example.org and then only
+ polls connected(), as a sketch doing other work in loop() would.
+ It then sends a HTTP request with pipelined writes and checks that
+ a write made while the first chunk is unacknowledged reports the
+ part of the buffer it accepted.
+
+ Circuit:
+ * MKR NB 1500 board
+ * Antenna
+ * SIM card with data plan
+
+*/
+
+// libraries
+#include <MKRNB.h>
+
+#include "arduino_secrets.h"
+// Please enter your sensitive data in the Secret tab or arduino_secrets.h
+// PIN Number
+const char PINNUMBER[] = SECRET_PINNUMBER;
+
+// initialize the library instance
+NB nbAccess;
+GPRS gprsAccess;
+NBClient client(false);  // asynchronous client
+
+// messages for serial monitor response
+String oktext = "OK";
+String errortext = "ERROR";
+
+// server and port
+char server[] = "example.org";
+int port = 80;
+
+// longest wait for the connection and for the response, in milliseconds
+const unsigned long connectTimeout = 180000;
+const unsigned long responseTimeout = 30000;
+
+// request start, smaller than one chunk so it is sent right away
+const char requestStart[] = "GET / HTTP/1.1\r\nHost: example.org\r\n";
+
+// padding header larger than a chunk, so it can't all be accepted at once
+const int paddingSize = 1000;
+char requestEnd[paddingSize + 64];
+
+void setup() {
+  // initialize serial communications and wait for port to open:
+  Serial.begin(9600);
+  while (!Serial) {
+    ; // wait for serial port to connect. Needed for native USB port only
+  }
+}
+
+void loop() {
+  // start module
+  // if your SIM has PIN, pass it as a parameter of begin() in quotes
+  Serial.print("Connecting NB IoT / LTE Cat M1 network...");
+  if (nbAccess.begin(PINNUMBER) != NB_READY) {
+    Serial.println(errortext);
+    while (true);
+  }
+  Serial.println(oktext);
+
+  // attach GPRS
+  Serial.print("Attaching to GPRS...");
+  if (gprsAccess.attachGPRS() != GPRS_READY) {
+    Serial.println(errortext);
+    while (true);
+  }
+  Serial.println(oktext);
+
+  // only start the connection, it completes while connected() is polled
+  Serial.print("Starting asynchronous connection to example.org...");
+  if (!client.connect(server, port)) {
+    Serial.println(errortext);
+    while (true);
+  }
+  Serial.println(oktext);
+
+  Serial.print("Polling connected()...");
+  unsigned long start = millis();
+  while (!client.connected()) {
+    if (millis() - start > connectTimeout) {
+      Serial.println(errortext);
+      Serial.println("connected() never became true");
+      while (true);
+    }
+  }
+  Serial.print(oktext);
+  Serial.print(" after ");
+  Serial.print(millis() - start);
+  Serial.println(" ms");
+
+  // pipelined writes
+  strcpy(requestEnd, "X-Padding: ");
+  int length = strlen(requestEnd);
+  memset(requestEnd + length, 'a', paddingSize);
+  requestEnd[length + paddingSize] = '\0';
+  strcat(requestEnd, "\r\nConnection: close\r\n\r\n");
+
+  size_t startSize = strlen(requestStart);
+  size_t endSize = strlen(requestEnd);
+
+  client.beginWrite(false);
+
+  Serial.print("Writing the first chunk...");
+  size_t written = client.write((const uint8_t*)requestStart, startSize);
+  if (written != startSize) {
+    Serial.println(errortext);
+    Serial.print("accepted ");
+    Serial.print(written);
+    Serial.print(" of ");
+    Serial.println(startSize);
+    while (true);
+  }
+  Serial.println(oktext);
+
+  // the first chunk is in flight, this write can only stage one more chunk
+  Serial.print("Writing while the first chunk is unacknowledged...");
+  written = client.write((const uint8_t*)requestEnd, endSize);
+  if (written == 0 || written >= endSize) {
+    Serial.println(errortext);
+    Serial.print("expected a partial write, accepted ");
+    Serial.print(written);
+    Serial.print(" of ");
+    Serial.println(endSize);
+    while (true);
+  }
+  Serial.print(oktext);
+  Serial.print(", accepted ");
+  Serial.print(written);
+  Serial.print(" of ");
+  Serial.println(endSize);
+
+  // the sketch has to send the rest itself
+  Serial.print("Writing the rest...");
+  start = millis();
+  while (written < endSize) {
+    written += client.write((const uint8_t*)requestEnd + written, endSize - written);
+
+    if (millis() - start > responseTimeout || client.getWriteError()) {
+      Serial.println(errortext);
+      while (true);
+    }
+  }
+  client.endWrite(true);
+
+  if (client.pendingWriteBytes() != 0 || client.getWriteError()) {
+    Serial.println(errortext);
+    while (true);
+  }
+  Serial.println(oktext);
+
+  // the server only answers a complete request
+  Serial.print("Receiving response...");
+  String response;
+  start = millis();
+  while (response.length() < 12 && millis() - start < responseTimeout) {
+    if (client.available()) {
+      response += (char)client.read();
+    }
+  }
+  if (!response.startsWith("HTTP/1.1 ")) {
+    Serial.println(errortext);
+    while (true);
+  }
+  Serial.println(oktext);
+
+  client.stop();
+  Serial.println("TEST COMPLETE!");
+
+  while (true);
+}
@@ -0,0 +1 @@
+#define SECRET_PINNUMBER     ""
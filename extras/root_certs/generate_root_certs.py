@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+#
+# This file is part of the MKRNB library.
+# Copyright (C) 2018 Arduino SA (http://www.arduino.cc/)
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# Generates src/utility/NBRootCerts.h from the certificates listed in
+# root_certs.txt. The certificates are packed against a shared dictionary
+# of the DER sections they have in common (algorithm OIDs, name attributes,
+# extensions, ...) and expanded again by NBSSLClient while uploading them.
+#
+# Packed format, a sequence of tokens:
+#   0x00 - 0x7f  literal run of (b + 1) bytes, the bytes follow
+#   0x80 - 0xbf  copy (b & 0x3f) + 4 bytes from the dictionary at the
+#                16 bit big endian offset that follows
+#   0xc0 - 0xff  copy (b & 0x3f) + 4 bytes from earlier in the same
+#                certificate at the 16 bit big endian offset that follows
+#
+# The output only depends on the input files, running the script twice
+# gives the same header.
+#
+# Usage: python3 generate_root_certs.py [output]
+
+import base64
+import hashlib
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUTPUT = os.path.join(HERE, '..', '..', 'src', 'utility', 'NBRootCerts.h')
+
+MIN_MATCH = 4          # shortest copy worth a 3 byte token
+MAX_MATCH = 67         # longest copy a token can describe
+MIN_DICTIONARY = 8     # shortest shared section worth adding to the dictionary
+MAX_LITERAL = 128
+KEY = 4
+
+LICENSE = '''/*
+  This file is part of the MKRNB library.
+  Copyright (C) 2018 Arduino SA (http://www.arduino.cc/)
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+'''
+
+
+def read_list():
+    certs = []
+    with open(os.path.join(HERE, 'root_certs.txt')) as f:
+        for line in f:
+            line = line.split('#')[0].split()
+            if not line:
+                continue
+
+            name = line[0]
+            flags = line[1:]
+            data = None
+
+            if 'remove' not in flags:
+                data = read_pem(os.path.join(HERE, name + '.pem'))
+
+            certs.append((name, 'minimal' in flags, data))
+
+    return certs
+
+
+def read_pem(path):
+    with open(path) as f:
+        lines = [l.strip() for l in f if l.strip() and not l.startswith('-----')]
+
+    return base64.b64decode(''.join(lines))
+
+
+class Index:
+    """Positions of every KEY byte sequence in a growing buffer."""
+
+    def __init__(self):
+        self.data = bytearray()
+        self.positions = {}
+
+    def append(self, data):
+        start = len(self.data)
+        self.data += data
+        for i in range(max(0, start - KEY + 1), len(self.data) - KEY + 1):
+            self.positions.setdefault(bytes(self.data[i:i + KEY]), []).append(i)
+
+    def longest(self, data, pos, limit=None):
+        """Longest match of data[pos:] in the buffer, ending before limit."""
+        best_len, best_pos = 0, 0
+        for start in self.positions.get(bytes(data[pos:pos + KEY]), []):
+            end = len(self.data) if limit is None else limit
+            length = 0
+            while (pos + length < len(data) and start + length < end and
+                   self.data[start + length] == data[pos + length]):
+                length += 1
+            if length > best_len:
+                best_len, best_pos = length, start
+        return best_len, best_pos
+
+
+def shared_length(certs, index, data, pos):
+    """Longest section at data[pos:] that also occurs in another certificate."""
+    best = 0
+    for i, other in enumerate(certs):
+        if i == index or other is None:
+            continue
+        start = other.find(bytes(data[pos:pos + KEY]))
+        while start != -1:
+            length = 0
+            while (pos + length < len(data) and start + length < len(other) and
+                   other[start + length] == data[pos + length]):
+                length += 1
+            best = max(best, length)
+            start = other.find(bytes(data[pos:pos + KEY]), start + 1)
+    return best
+
+
+def copy_tokens(kind, offset, length):
+    tokens = bytearray()
+    while length:
+        n = min(length, MAX_MATCH)
+        if 0 < length - n < MIN_MATCH:
+            n = length - MIN_MATCH
+        tokens += bytes([kind | (n - MIN_MATCH), offset >> 8, offset & 0xff])
+        offset += n
+        length -= n
+    return tokens
+
+
+def pack(certs, index, dictionary):
+    data = certs[index]
+    own = Index()
+    out = bytearray()
+    literal = bytearray()
+
+    def flush():
+        for i in range(0, len(literal), MAX_LITERAL):
+            run = literal[i:i + MAX_LITERAL]
+            out.append(len(run) - 1)
+            out.extend(run)
+        del literal[:]
+
+    pos = 0
+    while pos < len(data):
+        dict_len, dict_pos = dictionary.longest(data, pos)
+        own_len, own_pos = own.longest(data, pos, limit=pos)
+        new_len = shared_length(certs, index, data, pos)
+
+        if max(dict_len, own_len) >= MIN_MATCH and max(dict_len, own_len) + MIN_MATCH > new_len:
+            flush()
+            if dict_len >= own_len:
+                out += copy_tokens(0x80, dict_pos, dict_len)
+                length = dict_len
+            else:
+                out += copy_tokens(0xc0, own_pos, own_len)
+                length = own_len
+        elif new_len >= MIN_DICTIONARY:
+            flush()
+            offset = len(dictionary.data)
+            dictionary.append(data[pos:pos + new_len])
+            out += copy_tokens(0x80, offset, new_len)
+            length = new_len
+        else:
+            literal.append(data[pos])
+            length = 1
+
+        own.append(data[pos:pos + length])
+        pos += length
+
+    flush()
+    return bytes(out)
+
+
+def expand(packed, dictionary, offset, length):
+    """Same algorithm as the expander in NBSSLClient.cpp."""
+    result = bytearray()
+    out = 0
+    i = 0
+    while i < len(packed) and out < offset + length:
+        token = packed[i]
+        if token < 0x80:
+            n = token + 1
+            chunk = lambda s, e: packed[i + 1 + s:i + 1 + e]
+            step = 1 + n
+        else:
+            n = (token & 0x3f) + MIN_MATCH
+            src = (packed[i + 1] << 8) | packed[i + 2]
+            if token < 0xc0:
+                chunk = lambda s, e, src=src: dictionary[src + s:src + e]
+            else:
+                chunk = lambda s, e, src=src: expand(packed, dictionary, src + s, e - s)
+            step = 3
+        s = max(offset, out) - out
+        e = min(offset + length, out + n) - out
+        if s < e:
+            result += chunk(s, e)
+        out += n
+        i += step
+    return bytes(result)
+
+
+def c_array(data, indent):
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append(indent + ', '.join('0x%02x' % b for b in data[i:i + 12]))
+    return ',\n'.join(lines)
+
+
+def main():
+    output = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_OUTPUT
+    entries = read_list()
+    certs = [data for _, _, data in entries]
+
+    dictionary = Index()
+    packed = [None if data is None else pack(certs, i, dictionary) for i, data in enumerate(certs)]
+    dictionary = bytes(dictionary.data)
+
+    for data, p in zip(certs, packed):
+        if data is not None:
+            assert expand(p, dictionary, 0, len(data)) == data
+            assert expand(p, dictionary, 100, 64) == data[100:164]
+
+    h = [LICENSE]
+    h.append('''
+// Generated by extras/root_certs/generate_root_certs.py, do not edit
+
+#ifndef _NBROOT_CERTS_H_INCLUDED
+#define _NBROOT_CERTS_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct NBRootCert {
+  const char* name;
+  const uint8_t* data;
+  const int size;
+  const char* md5; // hex MD5 of data, if set the upload is skipped when the modem has the same cert
+  const int packedSize; // if set, data is packed against NB_ROOT_CERTS_DICTIONARY
+};
+
+/* The bundled roots can be chosen at compile time with compiler flags:
+   NB_ROOT_CERTS_MINIMAL only keeps the roots used by the large cloud
+   services, and each NB_ROOT_CERT_<name> set to 0 or 1 drops or keeps a
+   single root. The removal of AmazonRootCA1 is always included, so the
+   table is never empty.
+*/
+#ifdef NB_ROOT_CERTS_MINIMAL
+#define NB_ROOT_CERTS_DEFAULT 0
+#else
+#define NB_ROOT_CERTS_DEFAULT 1
+#endif
+
+''')
+
+    for name, minimal, data in entries:
+        if data is None:
+            continue
+        macro = 'NB_ROOT_CERT_' + name.upper()
+        h.append('#ifndef %s\n#define %s %s\n#endif\n' % (macro, macro, '1' if minimal else 'NB_ROOT_CERTS_DEFAULT'))
+
+    h.append('\n// DER sections shared by the certificates\n')
+    h.append('static const uint8_t NB_ROOT_CERTS_DICTIONARY[] = {\n%s\n};\n' % c_array(dictionary, '  '))
+    h.append('\nstatic const NBRootCert NB_ROOT_CERTS[] = {\n')
+
+    for (name, minimal, data), p in zip(entries, packed):
+        if data is None:
+            h.append('  {\n    "%s",\n    NULL, // remove\n    0,\n    NULL,\n    0\n  },\n' % name)
+            continue
+        h.append('#if NB_ROOT_CERT_%s\n' % name.upper())
+        h.append('  {\n    "%s",\n    (const uint8_t[]){\n%s\n    },\n    %d,\n    "%s",\n    %d\n  },\n#endif\n' %
+                 (name, c_array(p, '      '), len(data), hashlib.md5(data).hexdigest(), len(p)))
+
+    h.append('''};
+
+#define NB_NUM_ROOT_CERTS (sizeof(NB_ROOT_CERTS) / sizeof(NB_ROOT_CERTS[0]))
+
+#endif
+''')
+
+    with open(output, 'w') as f:
+        f.write(''.join(h))
+
+    der = sum(len(d) for d in certs if d is not None)
+    stored = sum(len(p) for p in packed if p is not None) + len(dictionary)
+    print('%d bytes of DER stored in %d bytes (%d dictionary)' % (der, stored, len(dictionary)))
+
+
+if __name__ == '__main__':
+    main()
@@ -24,12 +24,17 @@
 #include "NB_SMS.h"
 #include "GPRS.h"
 #include "NBClient.h"
+#include "NBServer.h"
 #include "NBModem.h"
 #include "NBScanner.h"
 #include "NBPIN.h"
 
 #include "NBSSLClient.h"
+#include "NBSecurityProfile.h"
 #include "NBUdp.h"
+#include "NBSocketSet.h"
+#include "NBConnectionPool.h"
+#include "NBDnsCache.h"
 
 #include "NBFileUtils.h"
 
@@ -20,6 +20,7 @@
 #include "Modem.h"
 
 #define MODEM_MIN_RESPONSE_OR_URC_WAIT_TIME_MS 20
+#define MODEM_WRITE_ECHO_TIMEOUT_MS 1000
 
 ModemUrcHandler* ModemClass::_urcHandlers[MAX_URC_HANDLERS] = { NULL };
 Print* ModemClass::_debugPrint = NULL;
@@ -31,6 +32,9 @@ ModemClass::ModemClass(Uart& uart, unsigned long baud, int resetPin, int powerOn
   _powerOnPin(powerOnPin),
   _vIntPin(vIntPin),
   _lastResponseOrUrcMillis(0),
+  _commandCount(0),
+  _uartByteCount(0),
+  _waitTime(0),
   _atCommandState(AT_COMMAND_IDLE),
   _ready(1),
   _responseDataStorage(NULL)
@@ -233,6 +237,8 @@ int ModemClass::reset()
 
 size_t ModemClass::write(uint8_t c)
 {
+  _uartByteCount++;
+
   return _uart->write(c);
 }
 
@@ -240,14 +246,22 @@ size_t ModemClass::write(const uint8_t* buf, size_t size)
 {
   size_t result = _uart->write(buf, size);
 
+  // data and its echo
+  _uartByteCount += result * 2;
+
   // the R410m echoes the binary data - we don't want it to do so
   size_t ignoreCount = 0;
+  unsigned long lastEchoMillis = millis();
 
   while (ignoreCount < result) {
     if (_uart->available()) {
       _uart->read();
 
       ignoreCount++;
+      lastEchoMillis = millis();
+    } else if ((millis() - lastEchoMillis) > MODEM_WRITE_ECHO_TIMEOUT_MS) {
+      // the echo was lost, do not wait for it forever
+      break;
     }
   }
 
@@ -265,6 +279,8 @@ void ModemClass::send(const char* command)
 
   _uart->println(command);
   _uart->flush();
+  _commandCount++;
+  _uartByteCount += strlen(command) + 2;
   _atCommandState = AT_COMMAND_IDLE;
   _ready = 0;
 }
@@ -281,11 +297,61 @@ void ModemClass::sendf(const char *fmt, ...)
   send(buf);
 }
 
+void ModemClass::beginCommandf(const char *fmt, ...)
+{
+  char buf[BUFSIZ];
+
+  va_list ap;
+  va_start((ap), (fmt));
+  vsnprintf(buf, sizeof(buf) - 1, fmt, ap);
+  va_end(ap);
+
+  unsigned long delta = millis() - _lastResponseOrUrcMillis;
+  if(delta < MODEM_MIN_RESPONSE_OR_URC_WAIT_TIME_MS) {
+    delay(MODEM_MIN_RESPONSE_OR_URC_WAIT_TIME_MS - delta);
+  }
+
+  _uart->print(buf);
+  _uartByteCount += strlen(buf);
+}
+
+void ModemClass::writeHex(const uint8_t* buffer, size_t size)
+{
+  static const char hex[] = "0123456789ABCDEF";
+  char chunk[64];
+
+  while (size) {
+    size_t length = 0;
+
+    while (size && length < sizeof(chunk)) {
+      chunk[length++] = hex[*buffer >> 4];
+      chunk[length++] = hex[*buffer & 0x0f];
+
+      buffer++;
+      size--;
+    }
+
+    _uart->write((const uint8_t*)chunk, length);
+    _uartByteCount += length;
+  }
+}
+
+void ModemClass::endCommand(const char* suffix)
+{
+  _uart->println(suffix);
+  _uart->flush();
+  _commandCount++;
+  _uartByteCount += strlen(suffix) + 2;
+  _atCommandState = AT_COMMAND_IDLE;
+  _ready = 0;
+}
+
 int ModemClass::waitForPrompt(unsigned long timeout)
 {
   for (unsigned long start = millis(); (millis() - start) < timeout;) {
     while (_uart->available()) {
       char c = _uart->read();
+      _uartByteCount++;
       if (_debugPrint) {
         _debugPrint->print(c);
       }
@@ -308,12 +374,14 @@ int ModemClass::waitForResponse(unsigned long timeout, String* responseDataStora
 
     if (r != 0) {
       _responseDataStorage = NULL;
+      _waitTime += millis() - start;
       return r;
     }
   }
 
   _responseDataStorage = NULL;
   _buffer = "";
+  _waitTime += timeout;
   return -1;
 }
 
@@ -328,6 +396,7 @@ void ModemClass::poll()
 {
   while (_uart->available()) {
     char c = _uart->read();
+    _uartByteCount++;
 
     if (_debugPrint) {
       _debugPrint->write(c);
@@ -417,14 +486,21 @@ void ModemClass::setResponseDataStorage(String* responseDataStorage)
   _responseDataStorage = responseDataStorage;
 }
 
-void ModemClass::addUrcHandler(ModemUrcHandler* handler)
+int ModemClass::addUrcHandler(ModemUrcHandler* handler)
 {
   for (int i = 0; i < MAX_URC_HANDLERS; i++) {
     if (_urcHandlers[i] == NULL) {
       _urcHandlers[i] = handler;
-      break;
+      return 1;
     }
   }
+
+  // the handler would miss its URCs, make it visible in the debug output
+  if (_debugPrint) {
+    _debugPrint->println("URC handler table full, increase MAX_URC_HANDLERS");
+  }
+
+  return 0;
 }
 
 void ModemClass::removeUrcHandler(ModemUrcHandler* handler)
@@ -442,6 +518,21 @@ void ModemClass::setBaudRate(unsigned long baud)
   _baud = baud;
 }
 
+unsigned long ModemClass::commandCount()
+{
+  return _commandCount;
+}
+
+unsigned long ModemClass::uartByteCount()
+{
+  return _uartByteCount;
+}
+
+unsigned long ModemClass::waitTime()
+{
+  return _waitTime;
+}
+
 #ifdef ARDUINO_PORTENTA_H7_M7
 #include <mbed.h>
 UART SerialSARA(PA_9, PA_10, NC, NC);
@@ -37,6 +37,16 @@
 #define SARA_VINT SARA_VINT_OFF
 #endif
 
+/* Every NBClient, NBSSLClient, NBUDP and NBServer object registers a URC
+   handler, whether it holds a modem socket or not, and so does the socket
+   buffer. The default covers a full NBConnectionPool (7 clients), a server,
+   the socket buffer and a few objects of the sketch, including the
+   temporary that NBServer::accept() copies from.
+*/
+#ifndef MAX_URC_HANDLERS
+#define MAX_URC_HANDLERS 16
+#endif
+
 class ModemUrcHandler {
 public:
   virtual void handleUrc(const String& urc) = 0;
@@ -73,17 +83,35 @@ public:
   void send(const String& command) { send(command.c_str()); }
   void sendf(const char *fmt, ...);
 
+  /** Stream a command to the UART in parts: beginCommandf() writes the
+      start of the command, writeHex() hex encodes data into it and
+      endCommand() terminates it, like send() does
+   */
+  void beginCommandf(const char *fmt, ...);
+  void writeHex(const uint8_t* buffer, size_t size);
+  void endCommand(const char* suffix = "");
+
   int waitForPrompt(unsigned long timeout = 500);
   int waitForResponse(unsigned long timeout = 200, String* responseDataStorage = NULL);
   int ready();
   void poll();
   void setResponseDataStorage(String* responseDataStorage);
 
-  void addUrcHandler(ModemUrcHandler* handler);
+  /** Register a handler for URCs
+      @param handler  Handler
+      @return 1 on success, 0 if MAX_URC_HANDLERS handlers are registered already
+   */
+  int addUrcHandler(ModemUrcHandler* handler);
   void removeUrcHandler(ModemUrcHandler* handler);
 
   void setBaudRate(unsigned long baud);
 
+  /** Library side traffic counters
+   */
+  unsigned long commandCount();
+  unsigned long uartByteCount();
+  unsigned long waitTime();
+
 private:
   Uart* _uart;
   unsigned long _baud;
@@ -91,6 +119,9 @@ private:
   int _powerOnPin;
   int _vIntPin;
   unsigned long _lastResponseOrUrcMillis;
+  unsigned long _commandCount;
+  unsigned long _uartByteCount;
+  unsigned long _waitTime;
 
   enum {
     AT_COMMAND_IDLE,
@@ -100,7 +131,6 @@ private:
   String _buffer;
   String* _responseDataStorage;
 
-  #define MAX_URC_HANDLERS 8 // 7 sockets + GPRS
   static ModemUrcHandler* _urcHandlers[MAX_URC_HANDLERS];
   static Print* _debugPrint;
 };
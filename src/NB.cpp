@@ -21,6 +21,11 @@
 
 #include "Modem.h"
 
+#include "utility/NBSocketBuffer.h"
+
+#include "NBSecurityProfile.h"
+#include "NB_SMS.h"
+
 #include "NB.h"
 
 __attribute__((weak)) void mkr_nb_feed_watchdog()
@@ -85,6 +90,11 @@ NB_NetworkStatus_t NB::begin(const char* pin, const char* apn, bool restart, boo
 
 NB_NetworkStatus_t NB::begin(const char* pin, const char* apn, const char* username, const char* password, bool restart, bool synchronous)
 {
+  // the modem may have restarted, nothing it was sent before can be relied on
+  NBSecurityProfile::reset();
+  // hex mode is only assumed again once AT+UDCONF=1,1 is acknowledged
+  NBSocketBuffer.setHexMode(false);
+
   if (!MODEM.begin(restart)) {
     _state = NB_ERROR;
   } else {
@@ -277,6 +287,7 @@ int NB::ready()
 
     case READY_STATE_SET_PREFERRED_MESSAGE_FORMAT: {
       MODEM.send("AT+CMGF=1");
+      NB_SMS::reset();
       _readyState = READY_STATE_WAIT_SET_PREFERRED_MESSAGE_FORMAT_RESPONSE;
       ready = 0;
       break;
@@ -306,6 +317,8 @@ int NB::ready()
         _state = NB_ERROR;
         ready = 2;
       } else {
+        // hex mode allows larger socket read and write transactions
+        NBSocketBuffer.setHexMode(true);
         _readyState = READY_STATE_SET_AUTOMATIC_TIME_ZONE;
         ready = 0;
       }
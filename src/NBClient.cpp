@@ -21,23 +21,48 @@
 
 #include "utility/NBSocketBuffer.h"
 
+#include "NBDnsCache.h"
 #include "NBClient.h"
 
+#define NB_CLIENT_FLUSH_TIMEOUT 10000
+#define NB_CLIENT_FLUSH_MAX_POLL_INTERVAL 2000
+
+// longest wait for +UUSOCO after an asynchronous AT+USOCO
+#define NB_CLIENT_CONNECT_URC_TIMEOUT 120000
+
 enum {
   CLIENT_STATE_IDLE,
   CLIENT_STATE_CREATE_SOCKET,
   CLIENT_STATE_WAIT_CREATE_SOCKET_RESPONSE,
+  CLIENT_STATE_SET_OPTION,
+  CLIENT_STATE_WAIT_SET_OPTION_RESPONSE,
   CLIENT_STATE_ENABLE_SSL,
   CLIENT_STATE_WAIT_ENABLE_SSL_RESPONSE,
   CLIENT_STATE_MANAGE_SSL_PROFILE,
   CLIENT_STATE_WAIT_MANAGE_SSL_PROFILE_RESPONSE,
+  CLIENT_STATE_RESOLVE_HOST,
+  CLIENT_STATE_WAIT_RESOLVE_HOST_RESPONSE,
   CLIENT_STATE_CONNECT,
   CLIENT_STATE_WAIT_CONNECT_RESPONSE,
+  CLIENT_STATE_WAIT_CONNECT_URC,
   CLIENT_STATE_CLOSE_SOCKET,
   CLIENT_STATE_WAIT_CLOSE_SOCKET,
   CLIENT_STATE_RETRIEVE_ERROR
 };
 
+// AT+USOSO commands, keepalive needs two of them
+enum {
+  CLIENT_OPTION_STEP_NODELAY,
+  CLIENT_OPTION_STEP_KEEPALIVE,
+  CLIENT_OPTION_STEP_KEEPIDLE,
+  CLIENT_OPTION_STEP_LINGER,
+  CLIENT_OPTION_STEP_TOS,
+  CLIENT_OPTION_NUM_STEPS
+};
+
+// used by SSL connections without a profile of their own
+static NBSecurityProfile defaultSecurityProfile(0);
+
 NBClient::NBClient(bool synch) :
   NBClient(-1, synch)
 {
@@ -48,20 +73,63 @@ NBClient::NBClient(int socket, bool synch) :
   _socket(socket),
   _connected(false),
   _state(CLIENT_STATE_IDLE),
+  _connectStart(0),
   _ip((uint32_t)0),
   _host(NULL),
   _port(0),
   _ssl(false),
-  _writeSync(true)
+  _sessionResumption(false),
+  _securityProfile(NULL),
+  _profileStep(0),
+  _options(0),
+  _optionStep(0),
+  _writeSync(true),
+  _writeInFlight(0),
+  _writeStagedSize(0)
 {
   MODEM.addUrcHandler(this);
 }
 
+NBClient::NBClient(const NBClient& other) :
+  NBClient(other._socket, other._synch)
+{
+  *this = other;
+}
+
 NBClient::~NBClient()
 {
   MODEM.removeUrcHandler(this);
 }
 
+NBClient& NBClient::operator=(const NBClient& other)
+{
+  // the URC handler registration stays with the object, only the state is copied
+  Client::operator=(other);
+
+  _synch = other._synch;
+  _socket = other._socket;
+  _connected = other._connected;
+  _state = other._state;
+  _connectStart = other._connectStart;
+  _ip = other._ip;
+  _host = other._host;
+  _port = other._port;
+  _ssl = other._ssl;
+  _sessionResumption = other._sessionResumption;
+  _securityProfile = other._securityProfile;
+  _profileStep = other._profileStep;
+  _options = other._options;
+  memcpy(_optionValues, other._optionValues, sizeof(_optionValues));
+  _optionStep = other._optionStep;
+  _writeSync = other._writeSync;
+  _writeInFlight = other._writeInFlight;
+  _writeStagedSize = other._writeStagedSize;
+  _writeStaged = other._writeStaged;
+  _response = other._response;
+
+  return *this;
+}
+
 int NBClient::ready()
 {
   int ready = MODEM.ready();
@@ -70,6 +138,25 @@ int NBClient::ready()
     return 0;
   }
 
+  if (_writeInFlight) {
+    // an asynchronous write chunk completed, send the staged one if any
+    size_t chunkSize = _writeInFlight;
+
+    _writeInFlight = 0;
+
+    if (handleWriteResponse(ready, chunkSize) == chunkSize && _writeStagedSize) {
+      MODEM.setResponseDataStorage(&_response);
+      MODEM.send(_writeStaged);
+
+      _writeInFlight = _writeStagedSize;
+      _writeStagedSize = 0;
+      return 0;
+    }
+
+    // drop the staged chunk after an error, the stream is broken anyway
+    _writeStagedSize = 0;
+  }
+
   switch (_state) {
     case CLIENT_STATE_IDLE:
     default: {
@@ -90,20 +177,50 @@ int NBClient::ready()
         _state = CLIENT_STATE_IDLE;
       } else {
         _socket = _response.charAt(_response.length() - 1) - '0';
+        NBSocketBuffer.open(_socket);
 
-        if (_ssl) {
-          _state = CLIENT_STATE_ENABLE_SSL;
-        } else {
-          _state = CLIENT_STATE_CONNECT;
-        }
-
+        _optionStep = 0;
+        _state = CLIENT_STATE_SET_OPTION;
         ready = 0;
       }
       break;
     }
 
+    case CLIENT_STATE_SET_OPTION: {
+      // options that were not set cost no round trip
+      while (_optionStep < CLIENT_OPTION_NUM_STEPS && !sendOption(_optionStep)) {
+        _optionStep++;
+      }
+
+      if (_optionStep < CLIENT_OPTION_NUM_STEPS) {
+        _optionStep++;
+        _state = CLIENT_STATE_WAIT_SET_OPTION_RESPONSE;
+      } else if (_ssl) {
+        _state = CLIENT_STATE_ENABLE_SSL;
+      } else if (_host != NULL) {
+        // SSL connects keep the hostname, the modem needs it for SNI
+        _state = CLIENT_STATE_RESOLVE_HOST;
+      } else {
+        _state = CLIENT_STATE_CONNECT;
+      }
+
+      ready = 0;
+      break;
+    }
+
+    case CLIENT_STATE_WAIT_SET_OPTION_RESPONSE: {
+      // not fatal, the connection works without the option
+      _state = CLIENT_STATE_SET_OPTION;
+      ready = 0;
+      break;
+    }
+
     case CLIENT_STATE_ENABLE_SSL: {
-      MODEM.sendf("AT+USOSEC=%d,1,0", _socket);
+      if (_securityProfile == NULL) {
+        defaultSecurityProfile.setSessionResumption(_sessionResumption);
+      }
+
+      MODEM.sendf("AT+USOSEC=%d,1,%d", _socket, securityProfile()->id());
 
       _state = CLIENT_STATE_WAIT_ENABLE_SSL_RESPONSE;
       ready = 0;
@@ -114,6 +231,7 @@ int NBClient::ready()
       if (ready > 1) {
         _state = CLIENT_STATE_CLOSE_SOCKET;
       } else {
+        _profileStep = 0;
         _state = CLIENT_STATE_MANAGE_SSL_PROFILE;
       }
 
@@ -122,28 +240,71 @@ int NBClient::ready()
     }
 
     case CLIENT_STATE_MANAGE_SSL_PROFILE: {
-      MODEM.send("AT+USECPRF=0,0,1");
+      NBSecurityProfile* profile = securityProfile();
+
+      if (_profileStep == 0) {
+        profile->claim();
+      }
+
+      // a profile pushed already costs no round trip
+      while (_profileStep < NB_PROFILE_NUM_STEPS && !profile->sendStep(_profileStep, sessionKey())) {
+        _profileStep++;
+      }
+
+      if (_profileStep < NB_PROFILE_NUM_STEPS) {
+        _profileStep++;
+        _state = CLIENT_STATE_WAIT_MANAGE_SSL_PROFILE_RESPONSE;
+      } else {
+        profile->sessionStarted(sessionKey());
+        _state = CLIENT_STATE_CONNECT;
+      }
 
-      _state = CLIENT_STATE_WAIT_MANAGE_SSL_PROFILE_RESPONSE;
       ready = 0;
       break;
     }
 
     case CLIENT_STATE_WAIT_MANAGE_SSL_PROFILE_RESPONSE: {
-      if (ready > 1) {
-        _state = CLIENT_STATE_CLOSE_SOCKET;
+      if (securityProfile()->stepDone(_profileStep - 1, ready == 1)) {
+        _state = CLIENT_STATE_MANAGE_SSL_PROFILE;
       } else {
+        _state = CLIENT_STATE_CLOSE_SOCKET;
+      }
+
+      ready = 0;
+      break;
+    }
+
+    case CLIENT_STATE_RESOLVE_HOST: {
+      if (NBDnsCache.lookup(_host, _ip)) {
         _state = CLIENT_STATE_CONNECT;
+      } else {
+        MODEM.setResponseDataStorage(&_response);
+        MODEM.sendf("AT+UDNSRN=0,\"%s\"", _host);
+
+        _state = CLIENT_STATE_WAIT_RESOLVE_HOST_RESPONSE;
+      }
+      ready = 0;
+      break;
+    }
+
+    case CLIENT_STATE_WAIT_RESOLVE_HOST_RESPONSE: {
+      // on failure let the modem resolve the hostname during connect
+      if (ready > 1 || !NBDnsCache.store(_host, _response, _ip)) {
+        _ip = (uint32_t)0;
       }
+
+      _state = CLIENT_STATE_CONNECT;
       ready = 0;
       break;
     }
 
     case CLIENT_STATE_CONNECT: {
-      if (_host != NULL) {
-        MODEM.sendf("AT+USOCO=%d,\"%s\",%d", _socket, _host, _port);
+      // in async mode the modem answers right away and reports
+      // the result with +UUSOCO, leaving the AT channel free
+      if (_host != NULL && _ip == IPAddress((uint32_t)0)) {
+        MODEM.sendf("AT+USOCO=%d,\"%s\",%d%s", _socket, _host, _port, _synch ? "" : ",1");
       } else {
-        MODEM.sendf("AT+USOCO=%d,\"%d.%d.%d.%d\",%d", _socket, _ip[0], _ip[1], _ip[2], _ip[3], _port);
+        MODEM.sendf("AT+USOCO=%d,\"%d.%d.%d.%d\",%d%s", _socket, _ip[0], _ip[1], _ip[2], _ip[3], _port, _synch ? "" : ",1");
       }
 
       _state = CLIENT_STATE_WAIT_CONNECT_RESPONSE;
@@ -153,6 +314,32 @@ int NBClient::ready()
 
     case CLIENT_STATE_WAIT_CONNECT_RESPONSE: {
       if (ready > 1) {
+        invalidateHost();
+        _state = CLIENT_STATE_CLOSE_SOCKET;
+
+        ready = 0;
+      } else if (!_synch) {
+        _connectStart = millis();
+        _state = CLIENT_STATE_WAIT_CONNECT_URC;
+
+        ready = 0;
+      } else {
+        NBSocketBuffer.setState(_socket, NB_SOCKET_STATE_CONNECTED);
+        _connected = true;
+        _state = CLIENT_STATE_IDLE;
+      }
+      break;
+    }
+
+    case CLIENT_STATE_WAIT_CONNECT_URC: {
+      int state = NBSocketBuffer.state(_socket);
+
+      if (state == NB_SOCKET_STATE_OPEN && (millis() - _connectStart) <= NB_CLIENT_CONNECT_URC_TIMEOUT) {
+        // still connecting
+        ready = 0;
+      } else if (state != NB_SOCKET_STATE_CONNECTED) {
+        // failed, or the URC never came and this connect is given up
+        invalidateHost();
         _state = CLIENT_STATE_CLOSE_SOCKET;
 
         ready = 0;
@@ -173,6 +360,7 @@ int NBClient::ready()
     }
 
     case CLIENT_STATE_WAIT_CLOSE_SOCKET: {
+      NBSocketBuffer.close(_socket);
       _state = CLIENT_STATE_RETRIEVE_ERROR;
       _socket = -1;
       break;
@@ -234,6 +422,8 @@ int NBClient::connect()
     stop();
   }
 
+  clearWriteError();
+
   if (_synch) {
     while (ready() == 0);
   } else if (ready() == 0) {
@@ -258,6 +448,7 @@ int NBClient::connect()
 void NBClient::beginWrite(bool sync)
 {
   _writeSync = sync;
+  clearWriteError();
 }
 
 size_t NBClient::write(uint8_t c)
@@ -275,7 +466,13 @@ size_t NBClient::write(const uint8_t* buf, size_t size)
   if (_writeSync) {
     while (ready() == 0);
   } else if (ready() == 0) {
-    return 0;
+    // a chunk is still in flight, prepare the next one so that it
+    // can be sent as soon as the modem acknowledges the current one
+    if (_socket == -1 || _writeInFlight == 0 || _writeStagedSize != 0) {
+      return 0;
+    }
+
+    return stageWriteChunk(buf, size);
   }
 
   if (_socket == -1) {
@@ -283,73 +480,295 @@ size_t NBClient::write(const uint8_t* buf, size_t size)
   }
 
   size_t written = 0;
-  String command;
+  size_t maxChunkSize = NBSocketBuffer.writeChunkSize();
+  size_t chunkSize = size;
+  String commands[2];
+  int current = 0;
 
-  command.reserve(19 + (size > 256 ? 256 : size) * 2);
+  if (chunkSize > maxChunkSize) {
+    chunkSize = maxChunkSize;
+  }
 
-  while (size) {
-    size_t chunkSize = size;
+  encodeWriteChunk(commands[current], buf, chunkSize);
 
-    if (chunkSize > 256) {
-      chunkSize = 256;
-    }
+  while (chunkSize) {
+    MODEM.setResponseDataStorage(&_response);
+    MODEM.send(commands[current]);
 
-    command.reserve(19 + chunkSize * 2);
+    size_t nextChunkSize = size - chunkSize;
 
-    command = "AT+USOWR=";
-    command += _socket;
-    command += ",";
-    command += chunkSize;
-    command += ",\"";
+    if (nextChunkSize > maxChunkSize) {
+      nextChunkSize = maxChunkSize;
+    }
 
-    for (size_t i = 0; i < chunkSize; i++) {
-      byte b = buf[i + written];
+    if (!_writeSync) {
+      // completion is handled by ready()
+      _writeInFlight = chunkSize;
+      written += chunkSize;
 
-      byte n1 = (b >> 4) & 0x0f;
-      byte n2 = (b & 0x0f);
+      if (nextChunkSize) {
+        written += stageWriteChunk(buf + written, nextChunkSize);
+      }
+      break;
+    }
 
-      command += (char)(n1 > 9 ? 'A' + n1 - 10 : '0' + n1);
-      command += (char)(n2 > 9 ? 'A' + n2 - 10 : '0' + n2);
+    // encode the next chunk while the modem is busy with this one
+    if (nextChunkSize) {
+      encodeWriteChunk(commands[current ^ 1], buf + written + chunkSize, nextChunkSize);
     }
 
-    command += "\"";
+    int status = MODEM.waitForResponse(10000, &_response);
+    size_t acked = handleWriteResponse(status, chunkSize);
 
-    MODEM.send(command);
-    if (_writeSync) {
-      String response;
-      int status = MODEM.waitForResponse(10000, &response);
-      if ( status != 1) {
-        if (status == 4 && response.indexOf("Operation not allowed") != -1 ) {
-          stop();
-          break;
-        } else {
-          break;
-        }
-      }
+    written += acked;
+
+    if (acked != chunkSize) {
+      break;
     }
 
-    written += chunkSize;
     size -= chunkSize;
+    chunkSize = nextChunkSize;
+    current ^= 1;
   }
 
   return written;
 }
 
-void NBClient::endWrite(bool /*sync*/)
+void NBClient::endWrite(bool sync)
 {
+  if (sync) {
+    while (ready() == 0);
+  }
+
   _writeSync = true;
 }
 
+size_t NBClient::pendingWriteBytes()
+{
+  ready();
+
+  return _writeInFlight + _writeStagedSize;
+}
+
+void NBClient::encodeWriteChunk(String& command, const uint8_t* buf, size_t size)
+{
+  command.reserve(19 + size * 2);
+
+  command = "AT+USOWR=";
+  command += _socket;
+  command += ",";
+  command += size;
+  command += ",\"";
+
+  for (size_t i = 0; i < size; i++) {
+    byte b = buf[i];
+
+    byte n1 = (b >> 4) & 0x0f;
+    byte n2 = (b & 0x0f);
+
+    command += (char)(n1 > 9 ? 'A' + n1 - 10 : '0' + n1);
+    command += (char)(n2 > 9 ? 'A' + n2 - 10 : '0' + n2);
+  }
+
+  command += "\"";
+}
+
+size_t NBClient::stageWriteChunk(const uint8_t* buf, size_t size)
+{
+  if (size > NBSocketBuffer.writeChunkSize()) {
+    size = NBSocketBuffer.writeChunkSize();
+  }
+
+  encodeWriteChunk(_writeStaged, buf, size);
+  _writeStagedSize = size;
+
+  return size;
+}
+
+size_t NBClient::handleWriteResponse(int status, size_t chunkSize)
+{
+  if (status != 1) {
+    setWriteError(status);
+
+    if (status == 4 && _response.indexOf("Operation not allowed") != -1) {
+      stop();
+    }
+
+    return 0;
+  }
+
+  // +USOWR: <socket>,<length>
+  int commaIndex = _response.lastIndexOf(',');
+
+  if (_response.startsWith("+USOWR: ") && commaIndex != -1) {
+    size_t acked = _response.substring(commaIndex + 1).toInt();
+
+    if (acked < chunkSize) {
+      setWriteError();
+
+      return acked;
+    }
+  }
+
+  return chunkSize;
+}
+
+int NBClient::setOption(int option, int value)
+{
+  if (option < NB_CLIENT_OPTION_NODELAY || option > NB_CLIENT_OPTION_TOS) {
+    return 0;
+  }
+
+  // only send the AT+USOSO commands belonging to this option
+  static const int firstStep[] = { CLIENT_OPTION_STEP_NODELAY, CLIENT_OPTION_STEP_KEEPALIVE, CLIENT_OPTION_STEP_LINGER, CLIENT_OPTION_STEP_TOS };
+  static const int lastStep[] = { CLIENT_OPTION_STEP_NODELAY, CLIENT_OPTION_STEP_KEEPIDLE, CLIENT_OPTION_STEP_LINGER, CLIENT_OPTION_STEP_TOS };
+
+  _options |= (1 << option);
+  _optionValues[option] = value;
+
+  if (_socket == -1 ||
+      ((_state == CLIENT_STATE_SET_OPTION || _state == CLIENT_STATE_WAIT_SET_OPTION_RESPONSE) && _optionStep <= firstStep[option])) {
+    // applied by the connect state machine
+    return 1;
+  }
+
+  if (_state != CLIENT_STATE_IDLE) {
+    // the connect is past the options, it is kept for the next connect
+    return 0;
+  }
+
+  while (ready() == 0);
+
+  for (int step = firstStep[option]; step <= lastStep[option]; step++) {
+    if (sendOption(step) && MODEM.waitForResponse(10000) != 1) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+void NBClient::setSessionResumption(bool enable)
+{
+  _sessionResumption = enable;
+}
+
+void NBClient::invalidateSession(const char* host)
+{
+  NBSecurityProfile::invalidateSessions(host);
+}
+
+void NBClient::setSecurityProfile(NBSecurityProfile& profile)
+{
+  _securityProfile = &profile;
+}
+
+NBSecurityProfile* NBClient::securityProfile()
+{
+  if (_securityProfile != NULL) {
+    return _securityProfile;
+  }
+
+  return &defaultSecurityProfile;
+}
+
+uint32_t NBClient::sessionKey()
+{
+  if (_host != NULL) {
+    return NBSecurityProfile::hostKey(_host);
+  }
+
+  return (uint32_t)_ip;
+}
+
+void NBClient::invalidateHost()
+{
+  // the address may have changed, resolve the name again on the next connect
+  if (_host != NULL) {
+    NBDnsCache.invalidate(_host);
+  }
+}
+
+bool NBClient::sendOption(int step)
+{
+  switch (step) {
+    case CLIENT_OPTION_STEP_NODELAY: {
+      if (!(_options & (1 << NB_CLIENT_OPTION_NODELAY))) {
+        return false;
+      }
+
+      MODEM.sendf("AT+USOSO=%d,6,1,%d", _socket, _optionValues[NB_CLIENT_OPTION_NODELAY] ? 1 : 0);
+      return true;
+    }
+
+    case CLIENT_OPTION_STEP_KEEPALIVE: {
+      if (!(_options & (1 << NB_CLIENT_OPTION_KEEPALIVE))) {
+        return false;
+      }
+
+      MODEM.sendf("AT+USOSO=%d,65535,8,%d", _socket, _optionValues[NB_CLIENT_OPTION_KEEPALIVE] > 0 ? 1 : 0);
+      return true;
+    }
+
+    case CLIENT_OPTION_STEP_KEEPIDLE: {
+      if (!(_options & (1 << NB_CLIENT_OPTION_KEEPALIVE)) || _optionValues[NB_CLIENT_OPTION_KEEPALIVE] <= 0) {
+        return false;
+      }
+
+      MODEM.sendf("AT+USOSO=%d,6,2,%d", _socket, _optionValues[NB_CLIENT_OPTION_KEEPALIVE]);
+      return true;
+    }
+
+    case CLIENT_OPTION_STEP_LINGER: {
+      if (!(_options & (1 << NB_CLIENT_OPTION_LINGER))) {
+        return false;
+      }
+
+      if (_optionValues[NB_CLIENT_OPTION_LINGER] < 0) {
+        MODEM.sendf("AT+USOSO=%d,65535,128,0", _socket);
+      } else {
+        MODEM.sendf("AT+USOSO=%d,65535,128,1,%d", _socket, _optionValues[NB_CLIENT_OPTION_LINGER]);
+      }
+      return true;
+    }
+
+    case CLIENT_OPTION_STEP_TOS: {
+      if (!(_options & (1 << NB_CLIENT_OPTION_TOS))) {
+        return false;
+      }
+
+      MODEM.sendf("AT+USOSO=%d,0,1,%d", _socket, _optionValues[NB_CLIENT_OPTION_TOS]);
+      return true;
+    }
+  }
+
+  return false;
+}
+
 uint8_t NBClient::connected()
 {
   MODEM.poll();
 
+  if (_state != CLIENT_STATE_IDLE) {
+    // connect in progress, the socket might not even be created yet
+    if (ready() == 0) {
+      return 0;
+    }
+  }
+
   if (_socket == -1) {
     return 0;
   }
 
-  // call available to update socket state
-  if (NBSocketBuffer.available(_socket) < 0 || (_ssl && !_connected)) {
+  int state = NBSocketBuffer.state(_socket);
+
+  if (state == NB_SOCKET_STATE_UNKNOWN) {
+    // socket not created by this library instance, ask the modem once
+    state = NBSocketBuffer.refreshState(_socket);
+  }
+
+  // a closed socket counts as connected while there is unread data
+  if ((state == NB_SOCKET_STATE_CLOSED && !NBSocketBuffer.readable(_socket)) || (_ssl && !_connected)) {
     stop();
 
     return 0;
@@ -427,11 +846,84 @@ int NBClient::peek()
 
 void NBClient::flush()
 {
+  unsigned long start = millis();
+
+  // libraries call this after every write, so it must not wait for acks
+  while (pendingWriteBytes() && (millis() - start) < NB_CLIENT_FLUSH_TIMEOUT);
+}
+
+int NBClient::flush(unsigned long timeout)
+{
+  unsigned long start = millis();
+  unsigned long interval = 100;
+
+  // get pending asynchronous chunks to the modem first
+  while (pendingWriteBytes()) {
+    if ((millis() - start) >= timeout) {
+      return 0;
+    }
+  }
+
+  while (_socket != -1) {
+    if (ready() != 0) {
+      int unacked = NBSocketBuffer.control(_socket, 11);
+
+      if (unacked == 0) {
+        return 1;
+      } else if (unacked < 0) {
+        // the query failed, waiting would not change that
+        return 0;
+      }
+    }
+
+    if ((millis() - start) + interval >= timeout) {
+      break;
+    }
+
+    delay(interval);
+
+    interval *= 2;
+    if (interval > NB_CLIENT_FLUSH_MAX_POLL_INTERVAL) {
+      interval = NB_CLIENT_FLUSH_MAX_POLL_INTERVAL;
+    }
+  }
+
+  return 0;
+}
+
+int NBClient::unackedBytes()
+{
+  if (ready() == 0 || _socket == -1) {
+    return -1;
+  }
+
+  return NBSocketBuffer.control(_socket, 11);
+}
+
+NBSocketStats NBClient::stats(bool query)
+{
+  NBSocketStats stats;
+
+  if (query) {
+    while (ready() == 0);
+  }
+
+  NBSocketBuffer.stats(_socket, stats, query, true);
+
+  return stats;
 }
 
 void NBClient::stop()
 {
   _state = CLIENT_STATE_IDLE;
+
+  if (_writeInFlight) {
+    MODEM.waitForResponse(10000);
+  }
+  _writeInFlight = 0;
+  _writeStagedSize = 0;
+  _writeStaged = "";
+
   if (_socket < 0) {
     return;
   }
@@ -21,9 +21,16 @@
 #define _NB_CLIENT_H_INCLUDED
 
 #include "Modem.h"
+#include "NBSecurityProfile.h"
+#include "utility/NBSocketBuffer.h"
 
 #include <Client.h>
 
+#define NB_CLIENT_OPTION_NODELAY   (0) // value: 1 to disable Nagle's algorithm
+#define NB_CLIENT_OPTION_KEEPALIVE (1) // value: idle time in ms before keepalive probes, 0 off
+#define NB_CLIENT_OPTION_LINGER    (2) // value: linger time in s, -1 off
+#define NB_CLIENT_OPTION_TOS       (3) // value: IP type of service byte
+
 class NBClient : public Client, public ModemUrcHandler {
 
 public:
@@ -39,8 +46,15 @@ public:
    */
   NBClient(int socket, bool synch);
 
+  /** Copy constructor, the copy receives URCs of its own, so a client
+      returned by NBServer::accept() can be stored and assigned
+   */
+  NBClient(const NBClient& other);
+
   virtual ~NBClient();
 
+  NBClient& operator=(const NBClient& other);
+
   /** Get last command status
       @return returns 0 if last command is still executing, 1 success, >1 error
   */
@@ -82,17 +96,53 @@ public:
   /** Write a characters buffer with size in request
       @param (uint8_t*) Buffer
       @param (size_t)   Buffer size
-      @return buffer size
+      @return bytes accepted, after beginWrite(false) this can be less than
+              the buffer size while a chunk is in flight, the rest has to be
+              written again
    */
   size_t write(const uint8_t*, size_t);
 
   /** Finish write request
-      @param sync     Sync mode
+      @param sync     Wait until all pending chunks have been acknowledged
    */
   void endWrite(bool sync = false);
 
-  /** Check if connected to server
-      @return 1 if connected
+  /** Number of bytes accepted by write() but not yet acknowledged by the modem
+      @return bytes in flight or staged for sending
+   */
+  size_t pendingWriteBytes();
+
+  /** Set a socket option, applied with AT+USOSO before the next connect
+      or right away if already connected
+      @param option   One of NB_CLIENT_OPTION_*
+      @param value    Option value
+      @return 1 on success, 0 on error or if a connect in progress has
+              already set the options, the option is then only kept for
+              the next connect
+   */
+  int setOption(int option, int value);
+
+  /** Let SSL connections resume the last TLS session with the same host
+      instead of doing a full handshake (AT+USECPRF operation 13)
+      @param enable   Enable session resumption
+   */
+  void setSessionResumption(bool enable);
+
+  /** Forget the TLS session kept for a host, the next SSL connection to
+      it does a full handshake
+      @param host     Hostname, NULL for any host
+   */
+  static void invalidateSession(const char* host = NULL);
+
+  /** Use a security profile for SSL connections instead of the default
+      one, a pushed profile lets connects skip AT+USECPRF entirely
+      @param profile  Security profile, must outlive the client
+   */
+  void setSecurityProfile(NBSecurityProfile& profile);
+
+  /** Check if connected to server, in async mode this also
+      advances a pending connect
+      @return 1 if connected, 0 if not or still connecting
    */
   uint8_t connected();
 
@@ -120,10 +170,30 @@ public:
    */
   int peek();
 
-  /** Flush response buffer
+  /** Hand the staged asynchronous writes to the modem, does not wait
+      for the peer, use flush(timeout) for that
    */
   void flush();
 
+  /** Wait until the peer has acknowledged all written data, polling
+      AT+USOCTL=<socket>,11 with an increasing interval
+      @param timeout  Time to wait in ms
+      @return 1 if all data was acknowledged, 0 on timeout or error
+   */
+  int flush(unsigned long timeout);
+
+  /** Number of written bytes not acknowledged by the peer yet, does not block
+      @return bytes not acknowledged, -1 if the modem cannot be queried now
+   */
+  int unackedBytes();
+
+  /** Traffic counters of this connection
+      @param query    Ask the modem for the socket byte counts, this costs
+                      three AT commands, the library counters are free
+      @return counters
+   */
+  NBSocketStats stats(bool query = true);
+
   /** Stop client
    */
   void stop();
@@ -131,19 +201,39 @@ public:
   virtual void handleUrc(const String& urc);
 
 private:
+  friend class NBSocketSet;
+
   int connect();
+  void encodeWriteChunk(String& command, const uint8_t* buf, size_t size);
+  size_t stageWriteChunk(const uint8_t* buf, size_t size);
+  size_t handleWriteResponse(int status, size_t chunkSize);
+  bool sendOption(int step);
+  NBSecurityProfile* securityProfile();
+  uint32_t sessionKey();
+  void invalidateHost();
 
   bool _synch;
   int _socket;
   int _connected;
 
   int _state;
+  unsigned long _connectStart;
   IPAddress _ip;
   const char* _host;
   uint16_t _port;
   bool _ssl;
+  bool _sessionResumption;
+  NBSecurityProfile* _securityProfile;
+  int _profileStep;
+
+  uint8_t _options;
+  int _optionValues[4];
+  int _optionStep;
 
   bool _writeSync;
+  size_t _writeInFlight;
+  size_t _writeStagedSize;
+  String _writeStaged;
   String _response;
 };
 
@@ -0,0 +1,184 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "NBSSLClient.h"
+
+#include "NBConnectionPool.h"
+
+NBConnectionPool::NBConnectionPool(int maxConnections, unsigned long idleTimeout) :
+  _maxConnections(maxConnections),
+  _idleTimeout(idleTimeout)
+{
+  if (_maxConnections < 1 || _maxConnections > NB_CONNECTION_POOL_MAX_CONNECTIONS) {
+    _maxConnections = NB_CONNECTION_POOL_MAX_CONNECTIONS;
+  }
+
+  for (int i = 0; i < NB_CONNECTION_POOL_MAX_CONNECTIONS; i++) {
+    _connections[i].client = NULL;
+    _connections[i].port = 0;
+    _connections[i].ssl = false;
+    _connections[i].inUse = false;
+    _connections[i].lastUsed = 0;
+  }
+}
+
+NBConnectionPool::~NBConnectionPool()
+{
+  clear();
+}
+
+NBClient* NBConnectionPool::acquire(const char* host, uint16_t port, bool ssl)
+{
+  evictIdle();
+
+  // look for an idle connection to the same endpoint first
+  for (int i = 0; i < _maxConnections; i++) {
+    if (_connections[i].client == NULL || _connections[i].inUse) {
+      continue;
+    }
+
+    if (_connections[i].port != port || _connections[i].ssl != ssl || _connections[i].host != host) {
+      continue;
+    }
+
+    if (_connections[i].client->connected()) {
+      _connections[i].inUse = true;
+
+      return _connections[i].client;
+    }
+
+    // peer closed it in the meantime
+    close(i);
+  }
+
+  int index = findFree();
+
+  if (index == -1) {
+    return NULL;
+  }
+
+  NBClient* client;
+
+  if (ssl) {
+    client = new NBSSLClient();
+  } else {
+    client = new NBClient();
+  }
+
+  if (client == NULL) {
+    return NULL;
+  }
+
+  _connections[index].host = host;
+
+  if (!client->connect(_connections[index].host.c_str(), port)) {
+    delete client;
+
+    return NULL;
+  }
+
+  _connections[index].client = client;
+  _connections[index].port = port;
+  _connections[index].ssl = ssl;
+  _connections[index].inUse = true;
+
+  return client;
+}
+
+void NBConnectionPool::release(NBClient* client)
+{
+  for (int i = 0; i < _maxConnections; i++) {
+    if (_connections[i].client == client) {
+      _connections[i].inUse = false;
+      _connections[i].lastUsed = millis();
+
+      if (!client->connected()) {
+        close(i);
+      }
+      break;
+    }
+  }
+}
+
+void NBConnectionPool::evictIdle()
+{
+  for (int i = 0; i < _maxConnections; i++) {
+    if (_connections[i].client != NULL && !_connections[i].inUse &&
+        (millis() - _connections[i].lastUsed) >= _idleTimeout) {
+      close(i);
+    }
+  }
+}
+
+void NBConnectionPool::clear()
+{
+  for (int i = 0; i < NB_CONNECTION_POOL_MAX_CONNECTIONS; i++) {
+    close(i);
+  }
+}
+
+int NBConnectionPool::size()
+{
+  int count = 0;
+
+  for (int i = 0; i < _maxConnections; i++) {
+    if (_connections[i].client != NULL) {
+      count++;
+    }
+  }
+
+  return count;
+}
+
+void NBConnectionPool::close(int index)
+{
+  if (_connections[index].client == NULL) {
+    return;
+  }
+
+  _connections[index].client->stop();
+  delete _connections[index].client;
+
+  _connections[index].client = NULL;
+  _connections[index].host = "";
+  _connections[index].inUse = false;
+}
+
+int NBConnectionPool::findFree()
+{
+  int oldest = -1;
+
+  for (int i = 0; i < _maxConnections; i++) {
+    if (_connections[i].client == NULL) {
+      return i;
+    }
+
+    if (!_connections[i].inUse &&
+        (oldest == -1 || (long)(_connections[i].lastUsed - _connections[oldest].lastUsed) < 0)) {
+      oldest = i;
+    }
+  }
+
+  // all slots taken, close the least recently used idle connection
+  if (oldest != -1) {
+    close(oldest);
+  }
+
+  return oldest;
+}
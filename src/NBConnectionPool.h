@@ -0,0 +1,80 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _NB_CONNECTION_POOL_H_INCLUDED
+#define _NB_CONNECTION_POOL_H_INCLUDED
+
+#include "NBClient.h"
+
+#define NB_CONNECTION_POOL_MAX_CONNECTIONS 7 // number of modem sockets
+
+class NBConnectionPool {
+
+public:
+  /** Constructor
+      @param maxConnections   Maximum number of sockets the pool may use
+      @param idleTimeout      Time in ms after which an unused connection is closed
+   */
+  NBConnectionPool(int maxConnections = NB_CONNECTION_POOL_MAX_CONNECTIONS, unsigned long idleTimeout = 60000);
+  virtual ~NBConnectionPool();
+
+  /** Get a connected client, reusing an idle connection to the same
+      host, port and TLS setting if one is still open
+      @param host     Hostname
+      @param port     Port
+      @param ssl      Use TLS (NBSSLClient)
+      @return connected client or NULL if the connection failed
+   */
+  NBClient* acquire(const char* host, uint16_t port, bool ssl = false);
+
+  /** Hand a client back to the pool, keeping the connection open for reuse
+      @param client   Client returned by acquire()
+   */
+  void release(NBClient* client);
+
+  /** Close connections that have been idle longer than the idle timeout
+   */
+  void evictIdle();
+
+  /** Close all connections
+   */
+  void clear();
+
+  /** Number of open connections, in use or idle
+   */
+  int size();
+
+private:
+  void close(int index);
+  int findFree();
+
+  int _maxConnections;
+  unsigned long _idleTimeout;
+
+  struct {
+    NBClient* client;
+    String host;
+    uint16_t port;
+    bool ssl;
+    bool inUse;
+    unsigned long lastUsed;
+  } _connections[NB_CONNECTION_POOL_MAX_CONNECTIONS];
+};
+
+#endif
@@ -0,0 +1,149 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "NBDnsCache.h"
+
+NBDnsCacheClass::NBDnsCacheClass() :
+  _ttl(NB_DNS_CACHE_DEFAULT_TTL),
+  _hits(0),
+  _misses(0)
+{
+  for (int i = 0; i < NB_DNS_CACHE_SIZE; i++) {
+    _entries[i].ip = (uint32_t)0;
+    _entries[i].resolved = 0;
+  }
+}
+
+void NBDnsCacheClass::setTtl(unsigned long ttl)
+{
+  _ttl = ttl;
+
+  if (_ttl == 0) {
+    invalidate();
+  }
+}
+
+bool NBDnsCacheClass::lookup(const char* host, IPAddress& ip)
+{
+  if (_ttl) {
+    for (int i = 0; i < NB_DNS_CACHE_SIZE; i++) {
+      if (_entries[i].host.length() == 0 || _entries[i].host != host) {
+        continue;
+      }
+
+      if ((millis() - _entries[i].resolved) >= _ttl) {
+        // expired
+        _entries[i].host = "";
+        break;
+      }
+
+      ip = _entries[i].ip;
+      _hits++;
+
+      return true;
+    }
+  }
+
+  _misses++;
+
+  return false;
+}
+
+int NBDnsCacheClass::resolve(const char* host, IPAddress& ip)
+{
+  if (lookup(host, ip)) {
+    return 1;
+  }
+
+  String response;
+
+  MODEM.sendf("AT+UDNSRN=0,\"%s\"", host);
+  if (MODEM.waitForResponse(70000, &response) != 1) {
+    return 0;
+  }
+
+  return store(host, response, ip) ? 1 : 0;
+}
+
+bool NBDnsCacheClass::store(const char* host, const String& response, IPAddress& ip)
+{
+  // +UDNSRN: "<ip>"
+  if (!response.startsWith("+UDNSRN: ")) {
+    return false;
+  }
+
+  int firstQuoteIndex = response.indexOf('"');
+  int secondQuoteIndex = response.indexOf('"', firstQuoteIndex + 1);
+
+  if (firstQuoteIndex == -1 || secondQuoteIndex == -1) {
+    return false;
+  }
+
+  if (!ip.fromString(response.substring(firstQuoteIndex + 1, secondQuoteIndex))) {
+    return false;
+  }
+
+  if (_ttl == 0) {
+    return true;
+  }
+
+  // reuse the entry for the same host, a free one or the oldest one
+  int index = 0;
+
+  for (int i = 0; i < NB_DNS_CACHE_SIZE; i++) {
+    if (_entries[i].host == host) {
+      index = i;
+      break;
+    }
+
+    if (_entries[i].host.length() == 0) {
+      index = i;
+    } else if (_entries[index].host.length() != 0 &&
+               (long)(_entries[i].resolved - _entries[index].resolved) < 0) {
+      index = i;
+    }
+  }
+
+  _entries[index].host = host;
+  _entries[index].ip = ip;
+  _entries[index].resolved = millis();
+
+  return true;
+}
+
+void NBDnsCacheClass::invalidate(const char* host)
+{
+  for (int i = 0; i < NB_DNS_CACHE_SIZE; i++) {
+    if (host == NULL || _entries[i].host == host) {
+      _entries[i].host = "";
+    }
+  }
+}
+
+unsigned long NBDnsCacheClass::hits()
+{
+  return _hits;
+}
+
+unsigned long NBDnsCacheClass::misses()
+{
+  return _misses;
+}
+
+NBDnsCacheClass NBDnsCache;
@@ -0,0 +1,85 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _NB_DNS_CACHE_H_INCLUDED
+#define _NB_DNS_CACHE_H_INCLUDED
+
+#include <IPAddress.h>
+
+#include "Modem.h"
+
+#define NB_DNS_CACHE_SIZE 4
+#define NB_DNS_CACHE_DEFAULT_TTL (5 * 60 * 1000UL)
+
+class NBDnsCacheClass {
+
+public:
+  NBDnsCacheClass();
+
+  /** Set how long resolved addresses are kept, the modem does not
+      report the record TTL so a fixed time is used
+      @param ttl      Time in ms, 0 disables the cache
+   */
+  void setTtl(unsigned long ttl);
+
+  /** Look up a hostname in the cache only, no AT command is sent
+      @param host     Hostname
+      @param ip       Resolved address
+      @return true if a valid entry was found
+   */
+  bool lookup(const char* host, IPAddress& ip);
+
+  /** Resolve a hostname, using the cache or AT+UDNSRN
+      @param host     Hostname
+      @param ip       Resolved address
+      @return 1 on success, 0 on failure
+   */
+  int resolve(const char* host, IPAddress& ip);
+
+  /** Parse a +UDNSRN response and add the address to the cache
+      @param host     Hostname that was resolved
+      @param response Response of AT+UDNSRN
+      @param ip       Resolved address
+      @return true if the response contained an address
+   */
+  bool store(const char* host, const String& response, IPAddress& ip);
+
+  /** Drop a cached hostname
+      @param host     Hostname, NULL drops all entries
+   */
+  void invalidate(const char* host = NULL);
+
+  unsigned long hits();
+  unsigned long misses();
+
+private:
+  unsigned long _ttl;
+  unsigned long _hits;
+  unsigned long _misses;
+
+  struct {
+    String host;
+    IPAddress ip;
+    unsigned long resolved;
+  } _entries[NB_DNS_CACHE_SIZE];
+};
+
+extern NBDnsCacheClass NBDnsCache;
+
+#endif
@@ -23,19 +23,89 @@
 
 #include "NBSSLClient.h"
 
+#define NB_SSL_CLIENT_PROMPT_TIMEOUT 500
+#define NB_SSL_CLIENT_CERT_RETRIES 3
+#define NB_SSL_CLIENT_UPLOAD_CHUNK_SIZE 64
+
 enum {
+  SSL_CLIENT_STATE_CHECK_ROOT_CERT,
+  SSL_CLIENT_STATE_WAIT_CHECK_ROOT_CERT_RESPONSE,
   SSL_CLIENT_STATE_LOAD_ROOT_CERT,
   SSL_CLIENT_STATE_WAIT_LOAD_ROOT_CERT_RESPONSE,
   SSL_CLIENT_STATE_WAIT_DELETE_ROOT_CERT_RESPONSE
 };
 
+// copy length bytes of a packed cert, starting at offset of the expanded
+// cert, see extras/root_certs/generate_root_certs.py for the format
+static void expandRootCert(const uint8_t* packed, size_t packedSize, size_t offset, uint8_t* buffer, size_t length)
+{
+  size_t out = 0;
+  size_t end = offset + length;
+
+  for (size_t i = 0; i < packedSize && out < end;) {
+    uint8_t token = packed[i];
+    const uint8_t* src = NULL;
+    size_t from = 0;
+    size_t n;
+
+    if (token < 0x80) {
+      // literal run
+      n = token + 1;
+      src = packed + i + 1;
+      i += 1 + n;
+    } else {
+      // copy from the dictionary or from earlier in the cert
+      n = (token & 0x3f) + 4;
+      from = (packed[i + 1] << 8) | packed[i + 2];
+      if (token < 0xc0) {
+        src = NB_ROOT_CERTS_DICTIONARY + from;
+      }
+      i += 3;
+    }
+
+    // the part of this token inside the requested range
+    size_t start = (offset > out) ? (offset - out) : 0;
+    size_t stop = (end < out + n) ? (end - out) : n;
+
+    if (start < stop) {
+      uint8_t* dest = buffer + (out + start - offset);
+
+      if (src != NULL) {
+        memcpy(dest, src + start, stop - start);
+      } else {
+        expandRootCert(packed, packedSize, from + start, dest, stop - start);
+      }
+    }
+
+    out += n;
+  }
+}
+
+static void readRootCert(const NBRootCert& cert, size_t offset, uint8_t* buffer, size_t length)
+{
+  if (cert.packedSize) {
+    expandRootCert(cert.data, cert.packedSize, offset, buffer, length);
+  } else {
+    memcpy(buffer, cert.data + offset, length);
+  }
+}
+
 bool NBSSLClient::_defaultRootCertsLoaded = false;
+int NBSSLClient::_certsUploaded = 0;
+int NBSSLClient::_certsSkipped = 0;
+int NBSSLClient::_certsFailed = 0;
+unsigned long NBSSLClient::_certsLoadStart = 0;
+unsigned long NBSSLClient::_certsLoadTime = 0;
 
 NBSSLClient::NBSSLClient(bool synch) :
   NBClient(synch),
   _RCs(NB_ROOT_CERTS),
   _numRCs(NB_NUM_ROOT_CERTS),
-  _customRootCerts(false)
+  _customRootCerts(false),
+  _customRootCertsLoaded(false),
+  _certIndex(0),
+  _certRetries(0),
+  _state(SSL_CLIENT_STATE_CHECK_ROOT_CERT)
 {
 }
 
@@ -44,7 +114,10 @@ NBSSLClient::NBSSLClient(const NBRootCert* myRCs, int myNumRCs, bool synch) :
   _RCs(myRCs),
   _numRCs(myNumRCs),
   _customRootCerts(true),
-  _customRootCertsLoaded(false)
+  _customRootCertsLoaded(false),
+  _certIndex(0),
+  _certRetries(0),
+  _state(SSL_CLIENT_STATE_CHECK_ROOT_CERT)
 {
 }
 
@@ -60,6 +133,8 @@ int NBSSLClient::ready()
     return NBClient::ready();
   }
 
+  // the certs are loaded one step per call, so that the
+  // application keeps running while the load is in progress
   int ready = MODEM.ready();
   if (ready == 0) {
     // a command is still running
@@ -67,19 +142,75 @@ int NBSSLClient::ready()
   }
 
   switch (_state) {
+    case SSL_CLIENT_STATE_CHECK_ROOT_CERT: {
+      if (_certIndex == 0 && _certRetries == 0) {
+        _certsUploaded = 0;
+        _certsSkipped = 0;
+        _certsFailed = 0;
+        _certsLoadStart = millis();
+      }
+
+      if (_RCs[_certIndex].size && _RCs[_certIndex].md5 != NULL) {
+        // ask the modem for the MD5 of the cert it has under this name
+        _certResponse = "";
+        MODEM.sendf("AT+USECMNG=4,0,\"%s\"", _RCs[_certIndex].name);
+        MODEM.setResponseDataStorage(&_certResponse);
+
+        _state = SSL_CLIENT_STATE_WAIT_CHECK_ROOT_CERT_RESPONSE;
+      } else {
+        _state = SSL_CLIENT_STATE_LOAD_ROOT_CERT;
+      }
+      ready = 0;
+      break;
+    }
+
+    case SSL_CLIENT_STATE_WAIT_CHECK_ROOT_CERT_RESPONSE: {
+      // an error means the cert is not stored in the modem
+      _certResponse.toLowerCase();
+
+      if (ready == 1 && _certResponse.indexOf(_RCs[_certIndex].md5) != -1) {
+        // identical cert stored already
+        _certsSkipped++;
+        ready = iterateCerts();
+      } else {
+        _state = SSL_CLIENT_STATE_LOAD_ROOT_CERT;
+        ready = 0;
+      }
+      break;
+    }
+
     case SSL_CLIENT_STATE_LOAD_ROOT_CERT: {
       if (_RCs[_certIndex].size) {
         // load the next root cert
         MODEM.sendf("AT+USECMNG=0,0,\"%s\",%d", _RCs[_certIndex].name, _RCs[_certIndex].size);
-        if (MODEM.waitForPrompt() != 1) {
-          // failure
-          ready = -1;
-        } else {
-          // send the cert contents
-          MODEM.write(_RCs[_certIndex].data, _RCs[_certIndex].size);
-          _state = SSL_CLIENT_STATE_WAIT_LOAD_ROOT_CERT_RESPONSE;
-          ready = 0;
+
+        // wait for the prompt here, another MODEM.poll() would consume it
+        if (MODEM.waitForPrompt(NB_SSL_CLIENT_PROMPT_TIMEOUT) != 1) {
+          // ESC cancels the upload, so the retry is not taken as cert data
+          MODEM.write(27);
+          MODEM.waitForResponse();
+
+          ready = retryCert();
+          break;
+        }
+
+        // send the whole cert now, until it is complete the modem takes
+        // everything written to it, including other AT commands, as data
+        uint8_t chunk[NB_SSL_CLIENT_UPLOAD_CHUNK_SIZE];
+
+        for (size_t offset = 0; offset < (size_t)_RCs[_certIndex].size; offset += sizeof(chunk)) {
+          size_t chunkSize = _RCs[_certIndex].size - offset;
+
+          if (chunkSize > sizeof(chunk)) {
+            chunkSize = sizeof(chunk);
+          }
+
+          readRootCert(_RCs[_certIndex], offset, chunk, chunkSize);
+          MODEM.write(chunk, chunkSize);
         }
+
+        _state = SSL_CLIENT_STATE_WAIT_LOAD_ROOT_CERT_RESPONSE;
+        ready = 0;
       } else {
         // remove the next root cert name
         MODEM.sendf("AT+USECMNG=2,0,\"%s\"", _RCs[_certIndex].name);
@@ -92,8 +223,9 @@ int NBSSLClient::ready()
 
     case SSL_CLIENT_STATE_WAIT_LOAD_ROOT_CERT_RESPONSE: {
       if (ready > 1) {
-        // error
+        ready = retryCert();
       } else {
+        _certsUploaded++;
         ready = iterateCerts();
       }
       break;
@@ -111,25 +243,39 @@ int NBSSLClient::ready()
 
 int NBSSLClient::connect(IPAddress ip, uint16_t port)
 {
-  _certIndex = 0;
-  _state = SSL_CLIENT_STATE_LOAD_ROOT_CERT;
-
+  // an interrupted cert load continues where it stopped
   return connectSSL(ip, port);
 }
 
 int NBSSLClient::connect(const char* host, uint16_t port)
 {
-  _certIndex = 0;
-  _state = SSL_CLIENT_STATE_LOAD_ROOT_CERT;
-
   return connectSSL(host, port);
 }
 
+int NBSSLClient::retryCert()
+{
+  _certRetries++;
+
+  if (_certRetries < NB_SSL_CLIENT_CERT_RETRIES) {
+    _state = SSL_CLIENT_STATE_LOAD_ROOT_CERT;
+    return 0;
+  }
+
+  // give up on this cert only, a missing root only affects
+  // the servers it is needed for
+  _certsFailed++;
+
+  return iterateCerts();
+}
+
 int NBSSLClient::iterateCerts()
 {
+  _certRetries = 0;
   _certIndex++;
   if (_certIndex == _numRCs) {
     // all certs loaded
+    _certsLoadTime = millis() - _certsLoadStart;
+
     if (_customRootCerts) {
       _customRootCertsLoaded = true;
     } else {
@@ -137,7 +283,55 @@ int NBSSLClient::iterateCerts()
     }
   } else {
     // load next
-    _state = SSL_CLIENT_STATE_LOAD_ROOT_CERT;
+    _state = SSL_CLIENT_STATE_CHECK_ROOT_CERT;
   }
   return 0;
 }
+
+int NBSSLClient::rootCertsUploaded()
+{
+  return _certsUploaded;
+}
+
+int NBSSLClient::rootCertsSkipped()
+{
+  return _certsSkipped;
+}
+
+int NBSSLClient::rootCertsFailed()
+{
+  return _certsFailed;
+}
+
+int NBSSLClient::rootCertsProgress()
+{
+  if ((!_customRootCerts && _defaultRootCertsLoaded) || _customRootCertsLoaded || _numRCs == 0) {
+    return 100;
+  }
+
+  unsigned long total = 0;
+  unsigned long done = 0;
+
+  for (int i = 0; i < _numRCs; i++) {
+    total += _RCs[i].size;
+
+    if (i < _certIndex) {
+      done += _RCs[i].size;
+    }
+  }
+
+  if (_state == SSL_CLIENT_STATE_WAIT_LOAD_ROOT_CERT_RESPONSE) {
+    done += _RCs[_certIndex].size;
+  }
+
+  if (total == 0) {
+    return (_certIndex * 100) / _numRCs;
+  }
+
+  return (done * 100) / total;
+}
+
+unsigned long NBSSLClient::rootCertsLoadTime()
+{
+  return _certsLoadTime;
+}
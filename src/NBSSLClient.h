@@ -36,14 +36,34 @@ public:
   virtual int connect(IPAddress ip, uint16_t port);
   virtual int connect(const char* host, uint16_t port);
 
+  /** Root certificate loading statistics of the last load
+   */
+  int rootCertsUploaded();
+  int rootCertsSkipped();
+  int rootCertsFailed();
+  unsigned long rootCertsLoadTime();
+
+  /** Progress of the root certificate load, in percent of the bytes
+   */
+  int rootCertsProgress();
+
   private:
+    int retryCert();
+
     const NBRootCert* _RCs;
     int _numRCs;
     static bool _defaultRootCertsLoaded;
     bool _customRootCerts;
     bool _customRootCertsLoaded;
     int _certIndex;
+    int _certRetries;
     int _state;
+    String _certResponse;
+    static int _certsUploaded;
+    static int _certsSkipped;
+    static int _certsFailed;
+    static unsigned long _certsLoadStart;
+    static unsigned long _certsLoadTime;
 };
 
 #endif
@@ -0,0 +1,379 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+
+#include "Modem.h"
+
+#include "NBSecurityProfile.h"
+
+// the settings, resetting the slot and dropping a session are decided on each claim and connect
+#define NB_PROFILE_ALL_STEPS (((1 << NB_PROFILE_NUM_STEPS) - 1) & ~(1 << NB_PROFILE_STEP_DROP_SESSION) & ~(1 << NB_PROFILE_STEP_RESET))
+
+// the object whose settings each slot of the modem holds
+NBSecurityProfile* NBSecurityProfile::_owners[NB_SECURITY_PROFILE_NUM_SLOTS] = { NULL };
+
+NBSecurityProfile::NBSecurityProfile(int id) :
+  _id(id),
+  _validation(NB_SECURITY_VALIDATION_ROOT_CERT),
+  _cipherSuite(0),
+  _hostname(NULL),
+  _clientCert(NULL),
+  _clientKey(NULL),
+  _psk(NULL),
+  _pskIdentity(NULL),
+  _resumption(false),
+  _dirty(NB_PROFILE_ALL_STEPS),
+  _resumptionActive(false),
+  _sessionKey(0)
+{
+  if (_id < 0 || _id >= NB_SECURITY_PROFILE_NUM_SLOTS) {
+    _id = 0;
+  }
+}
+
+int NBSecurityProfile::id()
+{
+  return _id;
+}
+
+void NBSecurityProfile::setValidation(int level)
+{
+  if (level != _validation) {
+    _validation = level;
+    _dirty |= (1 << NB_PROFILE_STEP_VALIDATION);
+  }
+}
+
+void NBSecurityProfile::setHostnameCheck(const char* hostname)
+{
+  _hostname = hostname;
+  _dirty |= (1 << NB_PROFILE_STEP_HOSTNAME);
+}
+
+void NBSecurityProfile::setCipherSuite(int cipherSuite)
+{
+  if (cipherSuite != _cipherSuite) {
+    _cipherSuite = cipherSuite;
+    _dirty |= (1 << NB_PROFILE_STEP_CIPHER_SUITE);
+  }
+}
+
+void NBSecurityProfile::setClientCert(const char* certName, const char* keyName)
+{
+  _clientCert = certName;
+  _clientKey = keyName;
+  _dirty |= (1 << NB_PROFILE_STEP_CLIENT_CERT) | (1 << NB_PROFILE_STEP_CLIENT_KEY);
+}
+
+int NBSecurityProfile::loadRootCert(const char* name, const uint8_t* cert, size_t size)
+{
+  return upload(0, name, cert, size, NULL);
+}
+
+int NBSecurityProfile::loadClientCert(const char* name, const uint8_t* cert, size_t size)
+{
+  if (!upload(1, name, cert, size, NULL)) {
+    return 0;
+  }
+
+  _clientCert = name;
+  _dirty |= (1 << NB_PROFILE_STEP_CLIENT_CERT);
+
+  return 1;
+}
+
+int NBSecurityProfile::loadPrivateKey(const char* name, const uint8_t* key, size_t size, const char* password)
+{
+  if (!upload(2, name, key, size, password)) {
+    return 0;
+  }
+
+  _clientKey = name;
+  _dirty |= (1 << NB_PROFILE_STEP_CLIENT_KEY);
+
+  return 1;
+}
+
+void NBSecurityProfile::setPreSharedKey(const char* psk, const char* identity)
+{
+  _psk = psk;
+  _pskIdentity = identity;
+  _dirty |= (1 << NB_PROFILE_STEP_PSK) | (1 << NB_PROFILE_STEP_PSK_IDENTITY);
+}
+
+void NBSecurityProfile::setSessionResumption(bool enable)
+{
+  if (enable != _resumption) {
+    _resumption = enable;
+    _dirty |= (1 << NB_PROFILE_STEP_RESUMPTION);
+  }
+}
+
+void NBSecurityProfile::invalidateSession(const char* host)
+{
+  if (host == NULL || hostKey(host) == _sessionKey) {
+    _sessionKey = 0;
+  }
+}
+
+void NBSecurityProfile::invalidateSessions(const char* host)
+{
+  for (int i = 0; i < NB_SECURITY_PROFILE_NUM_SLOTS; i++) {
+    if (_owners[i] != NULL) {
+      _owners[i]->invalidateSession(host);
+    }
+  }
+}
+
+int NBSecurityProfile::push()
+{
+  claim();
+
+  for (int step = 0; step < NB_PROFILE_NUM_STEPS; step++) {
+    if (sendStep(step, _sessionKey) && !stepDone(step, MODEM.waitForResponse(10000) == 1)) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+bool NBSecurityProfile::pushed()
+{
+  return (_owners[_id] == this && _dirty == 0);
+}
+
+uint32_t NBSecurityProfile::hostKey(const char* host)
+{
+  // FNV-1a
+  uint32_t hash = 2166136261UL;
+
+  while (*host) {
+    hash = (hash ^ (uint8_t)*host++) * 16777619UL;
+  }
+
+  return hash;
+}
+
+int NBSecurityProfile::upload(int type, const char* name, const uint8_t* data, size_t size, const char* password)
+{
+  // let a command still running finish, its answer is not the prompt
+  while (MODEM.ready() == 0);
+
+  if (password != NULL) {
+    MODEM.sendf("AT+USECMNG=0,%d,\"%s\",%d,\"%s\"", type, name, (int)size, password);
+  } else {
+    MODEM.sendf("AT+USECMNG=0,%d,\"%s\",%d", type, name, (int)size);
+  }
+
+  if (MODEM.waitForPrompt() != 1) {
+    // ESC cancels the upload, so the next commands are not taken as data
+    MODEM.write(27);
+    MODEM.waitForResponse();
+
+    return 0;
+  }
+
+  MODEM.write(data, size);
+
+  return (MODEM.waitForResponse(10000) == 1);
+}
+
+void NBSecurityProfile::claim()
+{
+  if (_owners[_id] == this) {
+    return;
+  }
+
+  // the slot holds the settings of another object or unknown ones, reset
+  // it to the factory defaults and only send the settings that differ
+  if (_owners[_id] != NULL) {
+    _owners[_id]->_dirty = NB_PROFILE_ALL_STEPS;
+    _owners[_id]->_resumptionActive = false;
+  }
+
+  _dirty = (1 << NB_PROFILE_STEP_RESET);
+  _resumptionActive = false;
+
+  for (int step = 0; step < NB_PROFILE_NUM_STEPS; step++) {
+    if ((NB_PROFILE_ALL_STEPS & (1 << step)) && !isFactoryDefault(step)) {
+      _dirty |= (1 << step);
+    }
+  }
+
+  _owners[_id] = this;
+}
+
+void NBSecurityProfile::reset()
+{
+  for (int i = 0; i < NB_SECURITY_PROFILE_NUM_SLOTS; i++) {
+    if (_owners[i] != NULL) {
+      _owners[i]->_dirty = NB_PROFILE_ALL_STEPS;
+      _owners[i]->_resumptionActive = false;
+      _owners[i]->_sessionKey = 0;
+      _owners[i] = NULL;
+    }
+  }
+}
+
+bool NBSecurityProfile::isFactoryDefault(int step)
+{
+  switch (step) {
+    case NB_PROFILE_STEP_VALIDATION:   return (_validation == NB_SECURITY_VALIDATION_NONE);
+    case NB_PROFILE_STEP_CIPHER_SUITE: return (_cipherSuite == 0);
+    case NB_PROFILE_STEP_HOSTNAME:     return (_hostname == NULL);
+    case NB_PROFILE_STEP_CLIENT_CERT:  return (_clientCert == NULL);
+    case NB_PROFILE_STEP_CLIENT_KEY:   return (_clientKey == NULL);
+    case NB_PROFILE_STEP_PSK:          return (_psk == NULL);
+    case NB_PROFILE_STEP_PSK_IDENTITY: return (_pskIdentity == NULL);
+    case NB_PROFILE_STEP_RESUMPTION:   return !_resumption;
+    default:                           return false;
+  }
+}
+
+bool NBSecurityProfile::sendStep(int step, uint32_t sessionKey)
+{
+  if (step == NB_PROFILE_STEP_DROP_SESSION) {
+    // the profile keeps the session of another host, disabling
+    // resumption discards it
+    if (!_resumption || !_resumptionActive || sessionKey == _sessionKey) {
+      return false;
+    }
+
+    MODEM.sendf("AT+USECPRF=%d,13,0", _id);
+    return true;
+  }
+
+  if (!(_dirty & (1 << step))) {
+    return false;
+  }
+
+  switch (step) {
+    case NB_PROFILE_STEP_RESET: {
+      MODEM.sendf("AT+USECPRF=%d", _id);
+      break;
+    }
+
+    case NB_PROFILE_STEP_VALIDATION: {
+      MODEM.sendf("AT+USECPRF=%d,0,%d", _id, _validation);
+      break;
+    }
+
+    case NB_PROFILE_STEP_CIPHER_SUITE: {
+      MODEM.sendf("AT+USECPRF=%d,2,%d", _id, _cipherSuite);
+      break;
+    }
+
+    // omitting the value resets an operation to its factory default
+    case NB_PROFILE_STEP_HOSTNAME: {
+      if (_hostname != NULL) {
+        MODEM.sendf("AT+USECPRF=%d,4,\"%s\"", _id, _hostname);
+      } else {
+        MODEM.sendf("AT+USECPRF=%d,4", _id);
+      }
+      break;
+    }
+
+    case NB_PROFILE_STEP_CLIENT_CERT: {
+      if (_clientCert != NULL) {
+        MODEM.sendf("AT+USECPRF=%d,5,\"%s\"", _id, _clientCert);
+      } else {
+        MODEM.sendf("AT+USECPRF=%d,5", _id);
+      }
+      break;
+    }
+
+    case NB_PROFILE_STEP_CLIENT_KEY: {
+      if (_clientKey != NULL) {
+        MODEM.sendf("AT+USECPRF=%d,6,\"%s\"", _id, _clientKey);
+      } else {
+        MODEM.sendf("AT+USECPRF=%d,6", _id);
+      }
+      break;
+    }
+
+    case NB_PROFILE_STEP_PSK: {
+      if (_psk != NULL) {
+        MODEM.sendf("AT+USECPRF=%d,8,\"%s\"", _id, _psk);
+      } else {
+        MODEM.sendf("AT+USECPRF=%d,8", _id);
+      }
+      break;
+    }
+
+    case NB_PROFILE_STEP_PSK_IDENTITY: {
+      if (_pskIdentity != NULL) {
+        MODEM.sendf("AT+USECPRF=%d,9,\"%s\"", _id, _pskIdentity);
+      } else {
+        MODEM.sendf("AT+USECPRF=%d,9", _id);
+      }
+      break;
+    }
+
+    case NB_PROFILE_STEP_RESUMPTION: {
+      MODEM.sendf("AT+USECPRF=%d,13,%d", _id, _resumption ? 1 : 0);
+      break;
+    }
+
+    default: {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool NBSecurityProfile::stepDone(int step, bool success)
+{
+  if (step == NB_PROFILE_STEP_DROP_SESSION || step == NB_PROFILE_STEP_RESUMPTION) {
+    // not fatal, firmware without session resumption does full handshakes
+    if (!success) {
+      _resumptionActive = false;
+      _dirty &= ~(1 << NB_PROFILE_STEP_RESUMPTION);
+    } else if (step == NB_PROFILE_STEP_DROP_SESSION) {
+      _resumptionActive = false;
+      _dirty |= (1 << NB_PROFILE_STEP_RESUMPTION);
+    } else {
+      _resumptionActive = _resumption;
+      _dirty &= ~(1 << NB_PROFILE_STEP_RESUMPTION);
+    }
+
+    return true;
+  }
+
+  if (!success && step == NB_PROFILE_STEP_RESET) {
+    // the slot could not be reset, send every setting instead
+    _dirty |= NB_PROFILE_ALL_STEPS;
+  } else if (!success && !isFactoryDefault(step)) {
+    return false;
+  }
+
+  // a failed reset to the factory default is not fatal, the operation
+  // might not exist in this firmware (PSK on some SARA-R4 versions)
+  _dirty &= ~(1 << step);
+
+  return true;
+}
+
+void NBSecurityProfile::sessionStarted(uint32_t sessionKey)
+{
+  if (_resumptionActive) {
+    _sessionKey = sessionKey;
+  }
+}
@@ -0,0 +1,179 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+
+#ifndef _NB_SECURITY_PROFILE_H_INCLUDED
+#define _NB_SECURITY_PROFILE_H_INCLUDED
+
+#include "Modem.h"
+
+#define NB_SECURITY_PROFILE_NUM_SLOTS 5
+
+// AT+USECPRF commands, each is only sent when its setting changed
+enum {
+  NB_PROFILE_STEP_RESET,
+  NB_PROFILE_STEP_VALIDATION,
+  NB_PROFILE_STEP_CIPHER_SUITE,
+  NB_PROFILE_STEP_HOSTNAME,
+  NB_PROFILE_STEP_CLIENT_CERT,
+  NB_PROFILE_STEP_CLIENT_KEY,
+  NB_PROFILE_STEP_PSK,
+  NB_PROFILE_STEP_PSK_IDENTITY,
+  NB_PROFILE_STEP_DROP_SESSION,
+  NB_PROFILE_STEP_RESUMPTION,
+  NB_PROFILE_NUM_STEPS
+};
+
+#define NB_SECURITY_VALIDATION_NONE          (0) // no server certificate validation
+#define NB_SECURITY_VALIDATION_ROOT_CERT     (1) // validate with the trusted root certs
+#define NB_SECURITY_VALIDATION_HOSTNAME      (2) // like 1, also check the expected hostname
+#define NB_SECURITY_VALIDATION_VALIDITY_DATE (3) // like 2, also check the validity date
+
+class NBSecurityProfile {
+
+public:
+  /** Constructor, nothing is sent to the modem until the profile is
+      pushed or used by a connection
+      @param id       Security profile slot of the modem, 0 - 4
+   */
+  NBSecurityProfile(int id = 0);
+
+  /** Security profile slot
+   */
+  int id();
+
+  /** Server certificate validation (AT+USECPRF operation 0)
+      @param level    One of NB_SECURITY_VALIDATION_*, default root cert validation
+   */
+  void setValidation(int level);
+
+  /** Hostname expected in the server certificate (AT+USECPRF operation 4),
+      checked with NB_SECURITY_VALIDATION_HOSTNAME or higher
+      @param hostname Hostname, NULL to clear
+   */
+  void setHostnameCheck(const char* hostname);
+
+  /** Cipher suite (AT+USECPRF operation 2)
+      @param cipherSuite  Cipher suite code of the modem, 0 for automatic
+   */
+  void setCipherSuite(int cipherSuite);
+
+  /** Client certificate and private key stored in the modem (AT+USECPRF
+      operations 5 and 6), used for mutual authentication
+      @param certName Internal name of the client certificate, NULL to clear
+      @param keyName  Internal name of the private key, NULL to clear
+   */
+  void setClientCert(const char* certName, const char* keyName);
+
+  /** Upload a trusted root certificate to the modem (AT+USECMNG type 0),
+      like NBSSLClient does with its root certificates
+      @param name     Internal name of the certificate
+      @param cert     Certificate, DER or PEM
+      @param size     Certificate size
+      @return 1 on success, 0 on error
+   */
+  int loadRootCert(const char* name, const uint8_t* cert, size_t size);
+
+  /** Upload a client certificate to the modem (AT+USECMNG type 1) and
+      use it for this profile
+      @param name     Internal name of the certificate
+      @param cert     Certificate, DER or PEM
+      @param size     Certificate size
+      @return 1 on success, 0 on error
+   */
+  int loadClientCert(const char* name, const uint8_t* cert, size_t size);
+
+  /** Upload a client private key to the modem (AT+USECMNG type 2) and
+      use it for this profile
+      @param name     Internal name of the key
+      @param key      Private key, DER or PEM
+      @param size     Key size
+      @param password Password of an encrypted key, NULL if not encrypted
+      @return 1 on success, 0 on error
+   */
+  int loadPrivateKey(const char* name, const uint8_t* key, size_t size, const char* password = NULL);
+
+  /** Pre-shared key and identity for TLS-PSK cipher suites (AT+USECPRF
+      operations 8 and 9)
+      @param psk      Pre-shared key, NULL to clear
+      @param identity PSK identity, NULL to clear
+   */
+  void setPreSharedKey(const char* psk, const char* identity);
+
+  /** Resume the last TLS session with the same host (AT+USECPRF operation 13)
+      @param enable   Enable session resumption
+   */
+  void setSessionResumption(bool enable);
+
+  /** Forget the TLS session kept by this profile
+      @param host     Hostname the session must belong to, NULL for any
+   */
+  void invalidateSession(const char* host = NULL);
+
+  /** Forget the TLS sessions kept by all profiles in the modem
+      @param host     Hostname the session must belong to, NULL for any
+   */
+  static void invalidateSessions(const char* host = NULL);
+
+  /** Send the changed settings to the modem now instead of on the next connect
+      @return 1 on success, 0 on error
+   */
+  int push();
+
+  /** Check if the modem holds the current settings
+      @return true if nothing needs to be sent
+   */
+  bool pushed();
+
+  /** Forget what the modem slots hold, called when the modem restarts
+      since the slots then hold their factory settings
+   */
+  static void reset();
+
+private:
+  friend class NBClient;
+
+  static uint32_t hostKey(const char* host);
+  static int upload(int type, const char* name, const uint8_t* data, size_t size, const char* password);
+
+  void claim();
+  bool isFactoryDefault(int step);
+  bool sendStep(int step, uint32_t sessionKey);
+  bool stepDone(int step, bool success);
+  void sessionStarted(uint32_t sessionKey);
+
+  int _id;
+  int _validation;
+  int _cipherSuite;
+  const char* _hostname;
+  const char* _clientCert;
+  const char* _clientKey;
+  const char* _psk;
+  const char* _pskIdentity;
+  bool _resumption;
+
+  // settings not sent yet and the state of the modem
+  uint16_t _dirty;
+  bool _resumptionActive;
+  uint32_t _sessionKey;
+
+  static NBSecurityProfile* _owners[NB_SECURITY_PROFILE_NUM_SLOTS];
+};
+
+#endif
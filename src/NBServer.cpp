@@ -0,0 +1,139 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "Modem.h"
+
+#include "utility/NBSocketBuffer.h"
+
+#include "NBServer.h"
+
+NBServer::NBServer(uint16_t port, bool synch) :
+  _port(port),
+  _synch(synch),
+  _socket(-1),
+  _numPending(0)
+{
+  MODEM.addUrcHandler(this);
+}
+
+NBServer::~NBServer()
+{
+  MODEM.removeUrcHandler(this);
+}
+
+int NBServer::begin()
+{
+  String response;
+
+  MODEM.send("AT+USOCR=6");
+
+  if (MODEM.waitForResponse(2000, &response) != 1 || !response.startsWith("+USOCR: ")) {
+    return 0;
+  }
+
+  _socket = response.charAt(response.length() - 1) - '0';
+  NBSocketBuffer.open(_socket);
+
+  MODEM.sendf("AT+USOLI=%d,%d", _socket, _port);
+  if (MODEM.waitForResponse(10000) != 1) {
+    stop();
+    return 0;
+  }
+
+  return 1;
+}
+
+NBClient NBServer::accept()
+{
+  MODEM.poll();
+
+  if (_numPending == 0) {
+    return NBClient(-1, _synch);
+  }
+
+  int socket = _pending[0];
+
+  _numPending--;
+  memmove(&_pending[0], &_pending[1], _numPending * sizeof(_pending[0]));
+
+  return NBClient(socket, _synch);
+}
+
+int NBServer::pending()
+{
+  MODEM.poll();
+
+  return _numPending;
+}
+
+void NBServer::stop()
+{
+  if (_socket < 0) {
+    return;
+  }
+
+  MODEM.sendf("AT+USOCL=%d", _socket);
+  MODEM.waitForResponse(10000);
+
+  NBSocketBuffer.close(_socket);
+
+  _socket = -1;
+}
+
+void NBServer::handleUrc(const String& urc)
+{
+  if (urc.startsWith("+UUSOLI: ")) {
+    // +UUSOLI: <socket>,"<ip>",<port>,<listening_socket>,"<local_ip>",<listening_port>
+    int listeningSocketIndex = urc.indexOf(',', urc.indexOf(',', urc.indexOf(',') + 1) + 1) + 1;
+
+    if (listeningSocketIndex == 0 || urc.charAt(listeningSocketIndex) - '0' != _socket) {
+      return;
+    }
+
+    int socket = urc.charAt(9) - '0';
+
+    // a connection the server does not keep would hold a modem socket for
+    // good, so there is a slot for every socket id and an id is only queued
+    // once, the queue cannot overflow
+    for (int i = 0; i < _numPending; i++) {
+      if (_pending[i] == socket) {
+        return;
+      }
+    }
+
+    if (_numPending < NB_SERVER_MAX_PENDING) {
+      _pending[_numPending++] = socket;
+    }
+  } else if (urc.startsWith("+UUSOCL: ")) {
+    int socket = urc.charAt(urc.length() - 1) - '0';
+
+    if (socket == _socket) {
+      _socket = -1;
+    } else {
+      // drop connections closed before they were accepted
+      for (int i = 0; i < _numPending; i++) {
+        if (_pending[i] == socket) {
+          _numPending--;
+          memmove(&_pending[i], &_pending[i + 1], (_numPending - i) * sizeof(_pending[0]));
+          break;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,68 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _NB_SERVER_H_INCLUDED
+#define _NB_SERVER_H_INCLUDED
+
+#include "Modem.h"
+#include "NBClient.h"
+
+#define NB_SERVER_MAX_PENDING 7 // number of modem sockets, one entry per socket id
+
+class NBServer : public ModemUrcHandler {
+
+public:
+  /** Constructor
+      @param port     Port to listen on
+      @param synch    Sync mode of the accepted clients
+   */
+  NBServer(uint16_t port, bool synch = true);
+  virtual ~NBServer();
+
+  /** Start listening
+      @return 1 on success, 0 if there are no sockets available
+   */
+  int begin();
+
+  /** Get the next incoming connection, only processes URCs and
+      never sends an AT command
+      @return connected client, evaluates to false if there is none
+   */
+  NBClient accept();
+
+  /** Number of incoming connections waiting to be accepted
+   */
+  int pending();
+
+  /** Stop listening, accepted clients stay connected
+   */
+  void stop();
+
+  virtual void handleUrc(const String& urc);
+
+private:
+  uint16_t _port;
+  bool _synch;
+  int _socket;
+
+  int _pending[NB_SERVER_MAX_PENDING];
+  int _numPending;
+};
+
+#endif
@@ -0,0 +1,188 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "Modem.h"
+
+#include "utility/NBSocketBuffer.h"
+
+#include "NBSocketSet.h"
+
+NBSocketSet::NBSocketSet() :
+  _sockets(0),
+  _readable(0),
+  _closed(0)
+{
+  clear();
+}
+
+void NBSocketSet::add(NBClient& client)
+{
+  add(client._socket);
+}
+
+void NBSocketSet::add(NBUDP& udp)
+{
+  // keep the object, its socket id changes when it is reopened
+  for (int i = 0; i < NB_SOCKET_SET_MAX_SOCKETS; i++) {
+    if (_udps[i] == &udp) {
+      return;
+    }
+  }
+
+  for (int i = 0; i < NB_SOCKET_SET_MAX_SOCKETS; i++) {
+    if (_udps[i] == NULL) {
+      _udps[i] = &udp;
+      return;
+    }
+  }
+}
+
+void NBSocketSet::add(int socket)
+{
+  if (socket < 0 || socket >= NB_SOCKET_SET_MAX_SOCKETS) {
+    return;
+  }
+
+  _sockets |= (1 << socket);
+}
+
+void NBSocketSet::remove(NBClient& client)
+{
+  remove(client._socket);
+}
+
+void NBSocketSet::remove(NBUDP& udp)
+{
+  for (int i = 0; i < NB_SOCKET_SET_MAX_SOCKETS; i++) {
+    if (_udps[i] == &udp) {
+      _udps[i] = NULL;
+    }
+  }
+
+  if (udp._socket >= 0 && udp._socket < NB_SOCKET_SET_MAX_SOCKETS) {
+    _readable &= ~(1 << udp._socket);
+    _closed &= ~(1 << udp._socket);
+  }
+}
+
+void NBSocketSet::remove(int socket)
+{
+  if (socket < 0 || socket >= NB_SOCKET_SET_MAX_SOCKETS) {
+    return;
+  }
+
+  _sockets &= ~(1 << socket);
+  _readable &= ~(1 << socket);
+  _closed &= ~(1 << socket);
+}
+
+void NBSocketSet::clear()
+{
+  for (int i = 0; i < NB_SOCKET_SET_MAX_SOCKETS; i++) {
+    _udps[i] = NULL;
+  }
+
+  _sockets = 0;
+  _readable = 0;
+  _closed = 0;
+}
+
+int NBSocketSet::wait(unsigned long timeout)
+{
+  unsigned long start = millis();
+
+  do {
+    MODEM.poll();
+
+    uint8_t sockets = _sockets;
+
+    for (int i = 0; i < NB_SOCKET_SET_MAX_SOCKETS; i++) {
+      if (_udps[i] != NULL && _udps[i]->_socket >= 0 && _udps[i]->_socket < NB_SOCKET_SET_MAX_SOCKETS) {
+        sockets |= (1 << _udps[i]->_socket);
+      }
+    }
+
+    _readable = 0;
+    _closed = 0;
+
+    for (int socket = 0; socket < NB_SOCKET_SET_MAX_SOCKETS; socket++) {
+      if (!(sockets & (1 << socket))) {
+        continue;
+      }
+
+      if (NBSocketBuffer.readable(socket)) {
+        _readable |= (1 << socket);
+      }
+
+      if (NBSocketBuffer.closed(socket)) {
+        _closed |= (1 << socket);
+      }
+    }
+
+    if (_readable || _closed) {
+      int count = 0;
+
+      for (uint8_t ready = (_readable | _closed); ready; ready &= (ready - 1)) {
+        count++;
+      }
+
+      return count;
+    }
+  } while ((millis() - start) < timeout);
+
+  return 0;
+}
+
+bool NBSocketSet::readable(NBClient& client)
+{
+  return readable(client._socket);
+}
+
+bool NBSocketSet::readable(NBUDP& udp)
+{
+  return readable(udp._socket);
+}
+
+bool NBSocketSet::readable(int socket)
+{
+  if (socket < 0 || socket >= NB_SOCKET_SET_MAX_SOCKETS) {
+    return false;
+  }
+
+  return (_readable & (1 << socket)) != 0;
+}
+
+bool NBSocketSet::closed(NBClient& client)
+{
+  return closed(client._socket);
+}
+
+bool NBSocketSet::closed(NBUDP& udp)
+{
+  return closed(udp._socket);
+}
+
+bool NBSocketSet::closed(int socket)
+{
+  if (socket < 0 || socket >= NB_SOCKET_SET_MAX_SOCKETS) {
+    return false;
+  }
+
+  return (_closed & (1 << socket)) != 0;
+}
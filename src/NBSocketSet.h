@@ -0,0 +1,78 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2018 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _NB_SOCKET_SET_H_INCLUDED
+#define _NB_SOCKET_SET_H_INCLUDED
+
+#include "NBClient.h"
+#include "NBUdp.h"
+
+#define NB_SOCKET_SET_MAX_SOCKETS 7
+
+class NBSocketSet {
+
+public:
+  NBSocketSet();
+
+  /** Add a connected client or a started UDP socket to the set, a UDP
+      object is followed when it reopens its socket under another id
+   */
+  void add(NBClient& client);
+  void add(NBUDP& udp);
+  void add(int socket);
+
+  /** Remove a client or UDP socket from the set
+   */
+  void remove(NBClient& client);
+  void remove(NBUDP& udp);
+  void remove(int socket);
+
+  /** Remove all sockets from the set
+   */
+  void clear();
+
+  /** Wait until a socket of the set has data or was closed by the peer,
+      only URCs are processed, no AT command is sent
+      @param timeout  Time to wait in ms, 0 checks once and returns
+      @return number of sockets that are readable or closed, 0 on timeout
+   */
+  int wait(unsigned long timeout = 0);
+
+  /** Result of the last wait() for a socket
+      @return true if data is waiting to be read
+   */
+  bool readable(NBClient& client);
+  bool readable(NBUDP& udp);
+  bool readable(int socket);
+
+  /** Result of the last wait() for a socket
+      @return true if the socket was closed
+   */
+  bool closed(NBClient& client);
+  bool closed(NBUDP& udp);
+  bool closed(int socket);
+
+private:
+  uint8_t _sockets;
+  NBUDP* _udps[NB_SOCKET_SET_MAX_SOCKETS];
+  uint8_t _readable;
+  uint8_t _closed;
+};
+
+#endif
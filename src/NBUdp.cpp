@@ -19,19 +19,38 @@
 
 #include <Modem.h>
 
+#include "utility/NBSocketBuffer.h"
+
+#include "NBDnsCache.h"
 #include "NBUdp.h"
 
-NBUDP::NBUDP() :
+// queued packet header: IP address, port and length
+#define NB_UDP_QUEUE_HEADER_SIZE 8
+
+NBUDP::NBUDP(size_t txBufferSize, size_t rxBufferSize) :
   _socket(-1),
-  _packetReceived(false),
   _txIp((uint32_t)0),
   _txHost(NULL),
   _txPort(0),
   _txSize(0),
+  _txBufferSize(txBufferSize),
+  _txBuffer(NULL),
+  _connectedMode(false),
+  _securityProfile(NULL),
+  _port(0),
+  _listening(false),
+  _peerIp((uint32_t)0),
+  _peerPort(0),
   _rxIp((uint32_t)0),
   _rxPort(0),
   _rxSize(0),
-  _rxIndex(0)
+  _rxIndex(0),
+  _rxBufferSize(rxBufferSize),
+  _rxBuffer(NULL),
+  _queueSize(0),
+  _queueHead(0),
+  _queueLength(0),
+  _queue(NULL)
 {
   MODEM.addUrcHandler(this);
 }
@@ -39,27 +58,53 @@ NBUDP::NBUDP() :
 NBUDP::~NBUDP()
 {
   MODEM.removeUrcHandler(this);
+
+  freeBuffers();
 }
 
 uint8_t NBUDP::begin(uint16_t port)
+{
+  _port = port;
+
+  return openSocket();
+}
+
+bool NBUDP::openSocket()
 {
   String response;
 
   MODEM.send("AT+USOCR=17");
 
   if (MODEM.waitForResponse(2000, &response) != 1) {
-    return 0;
+    return false;
   }
 
   _socket = response.charAt(response.length() - 1) - '0';
+  NBSocketBuffer.open(_socket);
+
+  if (_securityProfile != NULL) {
+    // DTLS, the handshake runs when the socket gets connected to its peer
+    if (!_securityProfile->push()) {
+      stop();
+      return false;
+    }
+
+    MODEM.sendf("AT+USOSEC=%d,1,%d", _socket, _securityProfile->id());
+    if (MODEM.waitForResponse(10000) != 1) {
+      stop();
+      return false;
+    }
+  }
 
-  MODEM.sendf("AT+USOLI=%d,%d", _socket, port);
+  MODEM.sendf("AT+USOLI=%d,%d", _socket, _port);
   if (MODEM.waitForResponse(10000) != 1) {
     stop();
-    return 0;
+    return false;
   }
 
-  return 1;
+  _listening = (_port != 0);
+
+  return true;
 }
 
 void NBUDP::stop()
@@ -71,7 +116,30 @@ void NBUDP::stop()
   MODEM.sendf("AT+USOCL=%d,1", _socket);
   MODEM.waitForResponse(10000);
 
+  NBSocketBuffer.close(_socket);
+
   _socket = -1;
+  _listening = false;
+  _peerIp = (uint32_t)0;
+  _peerPort = 0;
+
+  freeBuffers();
+}
+
+void NBUDP::freeBuffers()
+{
+  free(_txBuffer);
+  free(_rxBuffer);
+  free(_queue);
+
+  _txBuffer = NULL;
+  _rxBuffer = NULL;
+  _queue = NULL;
+  _queueHead = 0;
+  _queueLength = 0;
+  _txSize = 0;
+  _rxSize = 0;
+  _rxIndex = 0;
 }
 
 int NBUDP::beginPacket(IPAddress ip, uint16_t port)
@@ -94,8 +162,14 @@ int NBUDP::beginPacket(const char *host, uint16_t port)
     return 0;
   }
 
-  _txIp = (uint32_t)0;
-  _txHost = host;
+  // resolve once here instead of in every AT+USOST, keep the
+  // hostname so that the modem can resolve it if this fails
+  if (NBDnsCache.resolve(host, _txIp)) {
+    _txHost = NULL;
+  } else {
+    _txIp = (uint32_t)0;
+    _txHost = host;
+  }
   _txPort = port;
   _txSize = 0;
 
@@ -104,49 +178,145 @@ int NBUDP::beginPacket(const char *host, uint16_t port)
 
 int NBUDP::endPacket()
 {
-  String command;
+  return send(_txBuffer, _txSize);
+}
 
-  if (_txHost != NULL) {
-    command.reserve(26 + strlen(_txHost) + _txSize * 2);
-  } else {
-    command.reserve(41 + _txSize * 2);
+int NBUDP::sendPacket(IPAddress ip, uint16_t port, const uint8_t *buffer, size_t size)
+{
+  if (!beginPacket(ip, port)) {
+    return 0;
+  }
+
+  return send(buffer, size);
+}
+
+int NBUDP::sendPacket(const char *host, uint16_t port, const uint8_t *buffer, size_t size)
+{
+  if (!beginPacket(host, port)) {
+    return 0;
+  }
+
+  return send(buffer, size);
+}
+
+int NBUDP::sendPacket(IPAddress ip, uint16_t port, const NBUDPFragment *fragments, size_t count)
+{
+  if (!beginPacket(ip, port)) {
+    return 0;
+  }
+
+  return send(fragments, count);
+}
+
+int NBUDP::sendPacket(const char *host, uint16_t port, const NBUDPFragment *fragments, size_t count)
+{
+  if (!beginPacket(host, port)) {
+    return 0;
   }
 
-  command += "AT+USOST=";
-  command += _socket;
-  command += ",\"";
+  return send(fragments, count);
+}
+
+void NBUDP::setConnectedMode(bool enable)
+{
+  _connectedMode = enable;
+}
+
+void NBUDP::setSecurityProfile(NBSecurityProfile& profile)
+{
+  _securityProfile = &profile;
+}
+
+bool NBUDP::connectPeer()
+{
+  if (_peerPort != 0) {
+    return (_txHost == NULL && _txIp == _peerIp && _txPort == _peerPort);
+  }
 
   if (_txHost != NULL) {
-    command += _txHost;
-  } else {
-    command += _txIp[0];
-    command += '.';
-    command += _txIp[1];
-    command += '.';
-    command += _txIp[2];
-    command += '.';
-    command += _txIp[3];
+    return false;
   }
 
-  command += "\",";
-  command += _txPort;
-  command += ",",
-  command += _txSize;
-  command += ",\"";
+  MODEM.sendf("AT+USOCO=%d,\"%d.%d.%d.%d\",%d", _socket, _txIp[0], _txIp[1], _txIp[2], _txIp[3], _txPort);
+  if (MODEM.waitForResponse(10000) != 1) {
+    // not supported on this socket, don't try again for every packet
+    _connectedMode = false;
 
-  for (size_t i = 0; i < _txSize; i++) {
-    byte b = _txBuffer[i];
+    return false;
+  }
+
+  _peerIp = _txIp;
+  _peerPort = _txPort;
 
-    byte n1 = (b >> 4) & 0x0f;
-    byte n2 = (b & 0x0f);
+  return true;
+}
 
-    command += (char)(n1 > 9 ? 'A' + n1 - 10 : '0' + n1);
-    command += (char)(n2 > 9 ? 'A' + n2 - 10 : '0' + n2);
+bool NBUDP::disconnectPeer()
+{
+  // a connected socket only takes datagrams from its peer and AT+USOST
+  // to other destinations is not reliable on it, use a new unconnected socket
+  MODEM.sendf("AT+USOCL=%d,1", _socket);
+  MODEM.waitForResponse(10000);
+
+  NBSocketBuffer.close(_socket);
+
+  _socket = -1;
+  _peerIp = (uint32_t)0;
+  _peerPort = 0;
+
+  // the peer changed, don't connect again for every new destination
+  _connectedMode = false;
+
+  // the same setup as begin(), the buffers and the receive queue are kept
+  return openSocket();
+}
+
+int NBUDP::send(const uint8_t *buffer, size_t size)
+{
+  NBUDPFragment fragment = { buffer, size };
+
+  return send(&fragment, 1);
+}
+
+int NBUDP::send(const NBUDPFragment *fragments, size_t count)
+{
+  size_t size = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    size += fragments[i].size;
   }
 
-  command += "\"";
+  bool connected = false;
+
+  if (_securityProfile != NULL) {
+    // a DTLS socket must never fall back to plain AT+USOST
+    if (!connectPeer()) {
+      return 0;
+    }
+
+    connected = true;
+  } else if (_connectedMode && !_listening) {
+    connected = connectPeer();
+  }
 
-  MODEM.send(command);
+  if (!connected && _peerPort != 0 && !disconnectPeer()) {
+    return 0;
+  }
+
+  // stream the command to the modem, hex encoding each fragment on the way
+  if (connected) {
+    MODEM.beginCommandf("AT+USOWR=%d,%d,\"", _socket, (int)size);
+  } else if (_txHost != NULL) {
+    MODEM.beginCommandf("AT+USOST=%d,\"%s\",%d,%d,\"", _socket, _txHost, _txPort, (int)size);
+  } else {
+    MODEM.beginCommandf("AT+USOST=%d,\"%d.%d.%d.%d\",%d,%d,\"", _socket, _txIp[0], _txIp[1], _txIp[2], _txIp[3], _txPort, (int)size);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    MODEM.writeHex(fragments[i].data, fragments[i].size);
+  }
+
+  MODEM.endCommand("\"");
 
   if (MODEM.waitForResponse() == 1) {
     return 1;
@@ -166,7 +336,15 @@ size_t NBUDP::write(const uint8_t *buffer, size_t size)
     return 0;
   }
 
-  size_t spaceAvailable = sizeof(_txBuffer) - _txSize;
+  if (_txBuffer == NULL) {
+    _txBuffer = (uint8_t*)malloc(_txBufferSize);
+
+    if (_txBuffer == NULL) {
+      return 0;
+    }
+  }
+
+  size_t spaceAvailable = _txBufferSize - _txSize;
 
   if (size > spaceAvailable) {
     size = spaceAvailable;
@@ -178,6 +356,21 @@ size_t NBUDP::write(const uint8_t *buffer, size_t size)
   return size;
 }
 
+void NBUDP::setReceiveQueue(size_t queueSize)
+{
+  free(_queue);
+
+  // a smaller queue could never take a packet, see parsePacket()
+  if (queueSize != 0 && queueSize < (NB_UDP_QUEUE_HEADER_SIZE + _rxBufferSize)) {
+    queueSize = NB_UDP_QUEUE_HEADER_SIZE + _rxBufferSize;
+  }
+
+  _queue = NULL;
+  _queueSize = queueSize;
+  _queueHead = 0;
+  _queueLength = 0;
+}
+
 int NBUDP::parsePacket()
 {
   MODEM.poll();
@@ -186,42 +379,133 @@ int NBUDP::parsePacket()
     return 0;
   }
 
-  if (!_packetReceived) {
-    return 0;
+  if (_queueSize == 0) {
+    if (!NBSocketBuffer.readable(_socket)) {
+      return 0;
+    }
+
+    int size = receive();
+
+    MODEM.poll();
+
+    return size;
   }
-  _packetReceived = false;
 
-  String response;
+  if (_queue == NULL) {
+    _queue = (uint8_t*)malloc(_queueSize);
 
-  MODEM.sendf("AT+USORF=%d,%d", _socket, sizeof(_rxBuffer));
-  if (MODEM.waitForResponse(10000, &response) != 1) {
-    return 0;
+    if (_queue == NULL) {
+      return 0;
+    }
   }
 
-  if (!response.startsWith("+USORF: ")) {
-    return 0;
+  // move every packet waiting in the modem into the queue
+  while (NBSocketBuffer.readable(_socket) &&
+         (_queueSize - _queueLength) >= (NB_UDP_QUEUE_HEADER_SIZE + _rxBufferSize)) {
+    int size = receive();
+
+    if (size <= 0) {
+      break;
+    }
+
+    uint8_t header[NB_UDP_QUEUE_HEADER_SIZE] = {
+      _rxIp[0], _rxIp[1], _rxIp[2], _rxIp[3],
+      (uint8_t)(_rxPort >> 8), (uint8_t)_rxPort,
+      (uint8_t)(size >> 8), (uint8_t)size
+    };
+
+    queueWrite(header, sizeof(header));
+    queueWrite(_rxBuffer, size);
+
+    MODEM.poll();
   }
 
-  response.remove(0, 11);
+  _rxIndex = 0;
+  _rxSize = 0;
 
-  int firstQuoteIndex = response.indexOf('"');
-  if (firstQuoteIndex == -1) {
+  if (_queueLength == 0) {
     return 0;
   }
 
-  String ip = response.substring(0, firstQuoteIndex);
-  _rxIp.fromString(ip);
+  uint8_t header[NB_UDP_QUEUE_HEADER_SIZE];
+
+  queueRead(header, sizeof(header));
+
+  _rxIp = IPAddress(header[0], header[1], header[2], header[3]);
+  _rxPort = (header[4] << 8) | header[5];
+  _rxSize = (header[6] << 8) | header[7];
 
-  response.remove(0, firstQuoteIndex + 2);
+  queueRead(_rxBuffer, _rxSize);
+
+  return _rxSize;
+}
+
+int NBUDP::receive()
+{
+  if (_rxBuffer == NULL) {
+    _rxBuffer = (uint8_t*)malloc(_rxBufferSize);
+
+    if (_rxBuffer == NULL) {
+      return 0;
+    }
+  }
+
+  String response;
 
-  int firstCommaIndex = response.indexOf(',');
-  if (firstCommaIndex == -1) {
+  if (_securityProfile != NULL) {
+    // the DTLS socket is connected, data only comes from the peer
+    MODEM.sendf("AT+USORD=%d,%d", _socket, (int)_rxBufferSize);
+  } else {
+    MODEM.sendf("AT+USORF=%d,%d", _socket, (int)_rxBufferSize);
+  }
+
+  if (MODEM.waitForResponse(10000, &response) != 1) {
     return 0;
   }
 
-  String port = response.substring(0, firstCommaIndex);
-  _rxPort = port.toInt();
-  firstQuoteIndex = response.indexOf("\"");
+  int firstQuoteIndex;
+
+  if (_securityProfile != NULL) {
+    if (!response.startsWith("+USORD: ")) {
+      return 0;
+    }
+
+    firstQuoteIndex = response.indexOf('"');
+    if (firstQuoteIndex == -1) {
+      NBSocketBuffer.clearPending(_socket);
+      return 0;
+    }
+
+    _rxIp = _peerIp;
+    _rxPort = _peerPort;
+  } else {
+    if (!response.startsWith("+USORF: ")) {
+      return 0;
+    }
+
+    response.remove(0, 11);
+
+    firstQuoteIndex = response.indexOf('"');
+    if (firstQuoteIndex == -1) {
+      // nothing waiting, the pending count was too high
+      NBSocketBuffer.clearPending(_socket);
+      return 0;
+    }
+
+    String ip = response.substring(0, firstQuoteIndex);
+    _rxIp.fromString(ip);
+
+    response.remove(0, firstQuoteIndex + 2);
+
+    int firstCommaIndex = response.indexOf(',');
+    if (firstCommaIndex == -1) {
+      return 0;
+    }
+
+    String port = response.substring(0, firstCommaIndex);
+    _rxPort = port.toInt();
+    firstQuoteIndex = response.indexOf("\"");
+  }
 
   response.remove(0, firstQuoteIndex + 1);
   response.remove(response.length() - 1);
@@ -229,6 +513,10 @@ int NBUDP::parsePacket()
   _rxIndex = 0;
   _rxSize = response.length() / 2;
 
+  if (_rxSize > _rxBufferSize) {
+    _rxSize = _rxBufferSize;
+  }
+
   for (size_t i = 0; i < _rxSize; i++) {
     byte n1 = response[i * 2];
     byte n2 = response[i * 2 + 1];
@@ -248,11 +536,33 @@ int NBUDP::parsePacket()
     _rxBuffer[i] = (n1 << 4) | n2;
   }
 
-  MODEM.poll();
+  NBSocketBuffer.consumed(_socket, _rxSize);
 
   return _rxSize;
 }
 
+void NBUDP::queueWrite(const uint8_t *buffer, size_t size)
+{
+  size_t tail = (_queueHead + _queueLength) % _queueSize;
+
+  for (size_t i = 0; i < size; i++) {
+    _queue[tail] = buffer[i];
+    tail = (tail + 1) % _queueSize;
+  }
+
+  _queueLength += size;
+}
+
+void NBUDP::queueRead(uint8_t *buffer, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    buffer[i] = _queue[_queueHead];
+    _queueHead = (_queueHead + 1) % _queueSize;
+  }
+
+  _queueLength -= size;
+}
+
 int NBUDP::available()
 {
   if (_socket < 0) {
@@ -311,15 +621,19 @@ uint16_t NBUDP::remotePort()
   return _rxPort;
 }
 
-void NBUDP::handleUrc(const String& urc)
+NBSocketStats NBUDP::stats(bool query)
 {
-  if (urc.startsWith("+UUSORF: ")) {
-    int socket = urc.charAt(9) - '0';
+  NBSocketStats stats;
 
-    if (socket == _socket) {
-      _packetReceived = true;
-    }
-  } else if (urc.startsWith("+UUSOCL: ")) {
+  NBSocketBuffer.stats(_socket, stats, query, false);
+
+  return stats;
+}
+
+void NBUDP::handleUrc(const String& urc)
+{
+  // +UUSORF is tracked by NBSocketBuffer
+  if (urc.startsWith("+UUSOCL: ")) {
     int socket = urc.charAt(urc.length() - 1) - '0';
 
     if (socket == _socket) {
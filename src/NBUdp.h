@@ -23,11 +23,23 @@
 #include <Udp.h>
 
 #include "Modem.h"
+#include "NBSecurityProfile.h"
+#include "utility/NBSocketBuffer.h"
+
+#define NB_UDP_DEFAULT_BUFFER_SIZE 512
+
+// One part of a packet sent with NBUDP::sendPacket(), like a struct iovec
+struct NBUDPFragment {
+  const uint8_t* data;
+  size_t size;
+};
 
 class NBUDP : public UDP, public ModemUrcHandler {
 
 public:
-  NBUDP();  // Constructor
+  // Constructor, the packet buffers are only allocated when first used,
+  // a txBufferSize of 0 allows sending with sendPacket() only
+  NBUDP(size_t txBufferSize = NB_UDP_DEFAULT_BUFFER_SIZE, size_t rxBufferSize = NB_UDP_DEFAULT_BUFFER_SIZE);
   virtual ~NBUDP();
 
   virtual uint8_t begin(uint16_t);  // initialize, start listening on specified port. Returns 1 if successful, 0 if there are no sockets available to use
@@ -51,6 +63,30 @@ public:
 
   using Print::write;
 
+  // Send a packet straight from the caller's buffer, without copying it into the packet buffer
+  // Returns 1 if the packet was sent successfully, 0 if there was an error
+  int sendPacket(IPAddress ip, uint16_t port, const uint8_t *buffer, size_t size);
+  int sendPacket(const char *host, uint16_t port, const uint8_t *buffer, size_t size);
+  // Send the count fragments as one packet, for example a protocol header and its payload
+  int sendPacket(IPAddress ip, uint16_t port, const NBUDPFragment *fragments, size_t count);
+  int sendPacket(const char *host, uint16_t port, const NBUDPFragment *fragments, size_t count);
+
+  // Connect the socket to the first destination sent to, later packets to the
+  // same destination are sent with the shorter AT+USOWR. Sockets begun with a
+  // port other than 0 listen for any peer and are never connected. When the
+  // destination changes the socket is reopened unconnected, it may get
+  // another socket id but stays in the NBSocketSets it was added to
+  void setConnectedMode(bool enable);
+
+  // Secure the socket with DTLS using the given modem security profile, call before begin().
+  // The socket is connected to the first destination sent to and only talks to that peer
+  void setSecurityProfile(NBSecurityProfile& profile);
+
+  // Keep up to queueSize bytes of received packets in RAM, parsePacket() then reads every
+  // packet waiting in the modem at once. 0 (default) reads one packet per parsePacket().
+  // Sizes below the receive buffer size plus 8 are raised to it
+  void setReceiveQueue(size_t queueSize);
+
   // Start processing the next available incoming packet
   // Returns the size of the packet in bytes, or 0 if no packets are available
   virtual int parsePacket();
@@ -73,23 +109,52 @@ public:
   // Return the port of the host who sent the current incoming packet
   virtual uint16_t remotePort();
 
+  // Traffic counters of this socket, the modem byte counts cost two AT
+  // commands and are only queried if query is true
+  NBSocketStats stats(bool query = true);
+
   virtual void handleUrc(const String& urc);
 
 private:
+  friend class NBSocketSet;
+
+  int send(const uint8_t *buffer, size_t size);
+  int send(const NBUDPFragment *fragments, size_t count);
+  bool openSocket();
+  bool connectPeer();
+  bool disconnectPeer();
+  int receive();
+  void freeBuffers();
+  void queueWrite(const uint8_t *buffer, size_t size);
+  void queueRead(uint8_t *buffer, size_t size);
+
   int _socket;
-  bool _packetReceived;
 
   IPAddress _txIp;
   const char* _txHost;
   uint16_t _txPort;
   size_t _txSize;
-  uint8_t _txBuffer[512];
-  
+  size_t _txBufferSize;
+  uint8_t* _txBuffer;
+
+  bool _connectedMode;
+  NBSecurityProfile* _securityProfile;
+  uint16_t _port;
+  bool _listening;
+  IPAddress _peerIp;
+  uint16_t _peerPort;
+
   IPAddress _rxIp;
   uint16_t _rxPort;
   size_t _rxSize;
   size_t _rxIndex;
-  uint8_t _rxBuffer[512];
+  size_t _rxBufferSize;
+  uint8_t* _rxBuffer;
+
+  size_t _queueSize;
+  size_t _queueHead;
+  size_t _queueLength;
+  uint8_t* _queue;
 };
 
 #endif
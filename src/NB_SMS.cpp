@@ -21,6 +21,9 @@
 
 #include "NB_SMS.h"
 
+#include "utility/NBGsmAlphabet.h"
+#include "utility/NBSmsPdu.h"
+
 #define NYBBLETOHEX(x) ((x)<=9?(x)+'0':(x)-10+'A')
 #define HEXTONYBBLE(x) ((x)<='9'?(x)-'0':(x)+10-'A')
 #define ITOHEX(x) NYBBLETOHEX((x)&0xF)
@@ -36,6 +39,12 @@ enum {
 #define SMS_CHARSET_NONE  'N' 
 #define SMS_CHARSET_UCS2  'U'
 
+// message format selected with AT+CMGF, NB::ready() starts in text mode
+static bool smsPduMode = false;
+
+// concatenation reference of the last multi-part message sent
+static uint8_t smsReference = 0;
+
 NB_SMS::NB_SMS(bool synch) :
   _synch(synch),
   _state(SMS_STATE_IDLE),
@@ -43,60 +52,14 @@ NB_SMS::NB_SMS(bool synch) :
   _charset(SMS_CHARSET_NONE),
   _bufferUTF8{0,0,0,0},
   _indexUTF8(0),
-  _ptrUTF8("")
+  _ptrUTF8(""),
+  _pdu(false),
+  _rxIndex(0),
+  _rxNumParts(0),
+  _listed(0)
 {
 }
 
-/* Translation tables from GSM_03.38 are equal to UTF-8 for the 
- * positions 0x0A, 0x0D, 0x1B, 0x20-0x23, 0x25-0x3F, 0x41-0x5A, 0x61-0x7A.
- * Collect the others into two translation tables.
- * Code uses a simplified range test. */
-
-struct gsm_mapping {
-  const unsigned char gsmc;
-  const char *utf8;
-
-  gsm_mapping(const char gsmc, const char *utf8)
-    : gsmc(gsmc), utf8(utf8) {}
-};
-
-gsm_mapping _gsmUTF8map[] = {
-    {0x00,"@"},{0x10,"Δ"},           {0x40,"¡"},{0x60,"¿"},
-    {0x01,"£"},{0x11,"_"},
-    {0x02,"$"},{0x12,"Φ"},
-    {0x03,"¥"},{0x13,"Γ"},
-    {0x04,"è"},{0x14,"Λ"},{0x24,"¤"},
-    {0x05,"é"},{0x15,"Ω"},
-    {0x06,"ù"},{0x16,"Π"},
-    {0x07,"ì"},{0x17,"Ψ"},
-    {0x08,"ò"},{0x18,"Σ"},
-    {0x09,"Ç"},{0x19,"Θ"},
-/* Text mode SMS uses 0x1A as send marker so Ξ is not available. */
-             //{0x1A,"Ξ"},
-    {0x0B,"Ø"},                      {0x5B,"Ä"},{0x7B,"ä"},
-    {0x0C,"ø"},{0x1C,"Æ"},           {0x5C,"Ö"},{0x7C,"ö"},
-               {0x1D,"æ"},           {0x5D,"Ñ"},{0x7D,"ñ"},
-    {0x0E,"Å"},{0x1E,"ß"},           {0x5E,"Ü"},{0x7E,"ü"},
-    {0x0F,"å"},{0x1F,"É"},           {0x5F,"§"},{0x7F,"à"}};
-
-/* Text mode SMS uses 0x1B as abort marker so extended set is not available. */ 
-#if 0
-gsm_mapping _gsmXUTF8map[] = {
-    {0x40,"|"},
-    {0x14,"^"},
-    {0x65,"€"},
-    {0x28,"{"},
-    {0x29,"}"},
-    {0x0A,"\f"},
-    {0x1B,"\b"},
-    {0x3C,"["},
-    {0x0D,"\n"},{0x3D,"~"},
-    {0x3E,"]"},
-    {0x2F,"\\"}};
- */
-#endif
-
-
 int NB_SMS::setCharset(const char* charset)
 {
   String readcharset(0);
@@ -121,23 +84,59 @@ int NB_SMS::setCharset(const char* charset)
 }
 
 
+void NB_SMS::reset()
+{
+  smsPduMode = false;
+}
+
+void NB_SMS::setPduMode(bool enable)
+{
+  _pdu = enable;
+}
+
+int NB_SMS::selectMode()
+{
+  if (smsPduMode == _pdu) {
+    return 1;
+  }
+
+  while (MODEM.ready() == 0);
+
+  MODEM.sendf("AT+CMGF=%d", _pdu ? 0 : 1);
+  if (MODEM.waitForResponse() != 1) {
+    return 0;
+  }
+
+  smsPduMode = _pdu;
+
+  return 1;
+}
+
 size_t NB_SMS::write(uint8_t c)
 {
   if (_smsTxActive) {
-    if (_charset==SMS_CHARSET_GSM 
-        && (c >= 0x80 || c <= 0x24 || (c&0x1F) == 0 || (c&0x1F) >= 0x1B)) {
+    if (_pdu) {
+      // the alphabet and the split into parts depend on the whole text
+      _txMessage += (char)c;
+      return 1;
+    }
+    if (_charset==SMS_CHARSET_GSM) {
       _bufferUTF8[_indexUTF8++]=c;
-      if (_bufferUTF8[0] < 0x80 
-          || (_indexUTF8==2 && (_bufferUTF8[0]&0xE0) == 0xC0)
-          || (_indexUTF8==3 && (_bufferUTF8[0]&0xF0) == 0xE0)
+      uint8_t lead = _bufferUTF8[0];
+      if (lead < 0x80
+          || (_indexUTF8==2 && (lead&0xE0) == 0xC0)
+          || (_indexUTF8==3 && (lead&0xF0) == 0xE0)
           || _indexUTF8==4) {
-        for (auto &gsmchar : _gsmUTF8map) {
-          if (strncmp(_bufferUTF8, gsmchar.utf8, _indexUTF8)==0) {
-            _indexUTF8=0;
-            return MODEM.write(gsmchar.gsmc);
-          }
+        uint32_t code;
+        NBGsmAlphabet::decodeUtf8(_bufferUTF8, _indexUTF8, code);
+        int gsm = NBGsmAlphabet::fromUnicode(code);
+        /* Text mode SMS uses 0x1A as send marker and 0x1B as abort marker,
+         * so Ξ and the extension table are not available. */
+        if (gsm != -1 && !(gsm & NB_GSM_EXTENDED) && gsm != 0x1A) {
+          _indexUTF8=0;
+          return MODEM.write(gsm);
         }
-        // No UTF8 match, echo buffer
+        // No GSM character, echo buffer
         for (c=0; c < _indexUTF8; MODEM.write(_bufferUTF8[c++]));
         _indexUTF8 = 0;
       }
@@ -177,6 +176,20 @@ size_t NB_SMS::write(uint8_t c)
 
 int NB_SMS::beginSMS(const char* to)
 {
+  if (!selectMode()) {
+    _smsTxActive = false;
+
+    return (_synch) ? 0 : 2;
+  }
+
+  if (_pdu) {
+    _to = to;
+    _txMessage = "";
+    _smsTxActive = true;
+
+    return 1;
+  }
+
   setCharset();
   for(const char*iptr="AT+CMGS=\"";*iptr!=0;MODEM.write(*iptr++));
   if (_charset==SMS_CHARSET_UCS2 && *to == '+') {
@@ -223,7 +236,11 @@ int NB_SMS::ready()
 
     case SMS_STATE_LIST_MESSAGES: {
       MODEM.setResponseDataStorage(&_incomingBuffer);
-      MODEM.send("AT+CMGL=\"REC UNREAD\"");
+      if (_pdu) {
+        MODEM.send("AT+CMGL=4");
+      } else {
+        MODEM.send("AT+CMGL=\"REC UNREAD\"");
+      }
       _state = SMS_STATE_WAIT_LIST_MESSAGES_RESPONSE;
       ready = 0;
       break;
@@ -242,7 +259,9 @@ int NB_SMS::endSMS()
 {
   int r;
 
-  if (_smsTxActive) {
+  if (_smsTxActive && _pdu) {
+    return endPduSMS();
+  } else if (_smsTxActive) {
     // Echo remaining content of UTF8 buffer, empty if no conversion
     for (r=0; r < _indexUTF8; MODEM.write(_bufferUTF8[r++]));
     _indexUTF8 = 0;
@@ -260,8 +279,67 @@ int NB_SMS::endSMS()
   }
 }
 
+int NB_SMS::endPduSMS()
+{
+  const char* text = _txMessage.c_str();
+  size_t length = _txMessage.length();
+  int encoding = NBSmsPdu::encoding(text, length);
+  int total = NBSmsPdu::parts(text, length, encoding);
+  int r = 2;
+
+  _smsTxActive = false;
+
+  if (total > NB_SMS_MAX_PARTS) {
+    _txMessage = "";
+    return r;
+  }
+
+  smsReference++;
+
+  for (int part = 1; part <= total; part++) {
+    uint8_t pdu[NB_SMS_PDU_MAX_SIZE];
+    size_t consumed;
+    size_t size = NBSmsPdu::encodeSubmit(pdu, _to.c_str(), text, length, encoding, smsReference, part, total, consumed);
+
+    text += consumed;
+    length -= consumed;
+
+    // the length given to AT+CMGS does not count the SMSC field
+    MODEM.sendf("AT+CMGS=%d", (int)(size - 1));
+    if (MODEM.waitForPrompt(5000) != 1) {
+      // ESC cancels the message if the prompt came late
+      MODEM.write(27);
+      MODEM.waitForResponse();
+      r = 2;
+      break;
+    }
+
+    MODEM.writeHex(pdu, size);
+    MODEM.write(26);
+
+    // all parts but the last are always waited for
+    if (_synch || part < total) {
+      r = MODEM.waitForResponse(3*60*1000);
+
+      if (r != 1) {
+        break;
+      }
+    } else {
+      r = MODEM.ready();
+    }
+  }
+
+  _txMessage = "";
+
+  return r;
+}
+
 int NB_SMS::available()
 {
+  if (_pdu) {
+    return availablePdu();
+  }
+
   int nextMessageIndex = _incomingBuffer.indexOf("+CMGL: ");
 
   if (nextMessageIndex != -1) {
@@ -274,6 +352,9 @@ int NB_SMS::available()
     int r;
 
     if (_state == SMS_STATE_IDLE) {
+      if (!selectMode()) {
+        return 0;
+      }
       setCharset();
       _state = SMS_STATE_LIST_MESSAGES;
     }
@@ -311,8 +392,162 @@ int NB_SMS::available()
   return 0;
 }
 
+int NB_SMS::availablePdu()
+{
+  if (_incomingBuffer.length() != 0 && nextPduMessage()) {
+    return _rxMessage.length();
+  }
+
+  int r;
+
+  if (_state == SMS_STATE_IDLE) {
+    if (!selectMode()) {
+      return 0;
+    }
+    _incomingBuffer = "";
+    _listed = 0;
+    _state = SMS_STATE_LIST_MESSAGES;
+  }
+
+  if (_synch) {
+    unsigned long start = millis();
+    while ((r = ready()) == 0 && (millis() - start) < 3*60*1000) {
+      delay(100);
+    }
+  } else {
+    r = ready();
+  }
+
+  if (r != 1) {
+    return 0;
+  }
+
+  if (nextPduMessage()) {
+    return _rxMessage.length();
+  }
+
+  _incomingBuffer = "";
+
+  return 0;
+}
+
+/* AT+CMGL=4 lists the read and the unread messages, every part of a
+ * concatenated message stays on the SIM until the whole message is flushed.
+ * A message is returned when all its parts are listed and at least one of
+ * them was unread, the listing marks them read so it is returned once. */
+bool NB_SMS::nextPduMessage()
+{
+  const char* listing = _incomingBuffer.c_str();
+  NBSmsConcat concat;
+  String sender;
+  int position = 0;
+  int index;
+  int stat;
+  int pdu;
+  int pduEnd;
+
+  for (int k = 0; k < 32 && (position = nextPduEntry(position, index, stat, pdu, pduEnd)) != -1; k++) {
+    if (_listed & (1UL << k)) {
+      continue;
+    }
+
+    _listed |= (1UL << k);
+
+    if (!NBSmsPdu::decodeDeliver(listing + pdu, pduEnd - pdu, sender, NULL, concat) || concat.total > NB_SMS_MAX_PARTS) {
+      continue;
+    }
+
+    int pdus[NB_SMS_MAX_PARTS];
+    int pduEnds[NB_SMS_MAX_PARTS];
+    int total = concat.total;
+    int found = 1;
+    bool unread = (stat == 0);
+
+    for (int i = 0; i < total; i++) {
+      pdus[i] = -1;
+    }
+
+    pdus[concat.sequence - 1] = pdu;
+    pduEnds[concat.sequence - 1] = pduEnd;
+    _rxParts[concat.sequence - 1] = index;
+
+    if (total > 1) {
+      int reference = concat.reference;
+      int otherPosition = position;
+      String otherSender;
+
+      for (int j = k + 1; j < 32 && (otherPosition = nextPduEntry(otherPosition, index, stat, pdu, pduEnd)) != -1; j++) {
+        if ((_listed & (1UL << j))
+            || !NBSmsPdu::decodeDeliver(listing + pdu, pduEnd - pdu, otherSender, NULL, concat)
+            || concat.reference != reference || concat.total != total
+            || otherSender != sender || pdus[concat.sequence - 1] != -1) {
+          continue;
+        }
+
+        _listed |= (1UL << j);
+
+        pdus[concat.sequence - 1] = pdu;
+        pduEnds[concat.sequence - 1] = pduEnd;
+        _rxParts[concat.sequence - 1] = index;
+        unread |= (stat == 0);
+        found++;
+      }
+    }
+
+    if (found != total || !unread) {
+      continue;
+    }
+
+    _rxNumber = sender;
+    _rxMessage = "";
+    _rxIndex = 0;
+    _rxNumParts = total;
+
+    for (int i = 0; i < total; i++) {
+      NBSmsPdu::decodeDeliver(listing + pdus[i], pduEnds[i] - pdus[i], sender, &_rxMessage, concat);
+    }
+
+    return true;
+  }
+
+  return false;
+}
+
+int NB_SMS::nextPduEntry(int position, int& index, int& stat, int& pdu, int& pduEnd)
+{
+  // +CMGL: <index>,<stat>,[<alpha>],<length>\r\n<pdu>
+  position = _incomingBuffer.indexOf("+CMGL: ", position);
+  if (position == -1) {
+    return -1;
+  }
+
+  int statIndex = _incomingBuffer.indexOf(',', position);
+
+  pdu = _incomingBuffer.indexOf('\n', position) + 1;
+  if (statIndex == -1 || pdu == 0) {
+    return -1;
+  }
+
+  index = atoi(_incomingBuffer.c_str() + position + 7);
+  stat = atoi(_incomingBuffer.c_str() + statIndex + 1);
+
+  pduEnd = _incomingBuffer.indexOf('\r', pdu);
+  if (pduEnd == -1) {
+    pduEnd = _incomingBuffer.length();
+  }
+
+  return pduEnd;
+}
+
 int NB_SMS::remoteNumber(char* number, int nlength)
 {
+  if (_pdu) {
+    strncpy(number, _rxNumber.c_str(), nlength - 1);
+    number[nlength - 1] = '\0';
+
+    return (_rxNumber.length() != 0) ? 1 : 2;
+  }
+
   #define PHONE_NUMBER_START_SEARCH_PATTERN "\"REC UNREAD\",\""
   int phoneNumberStartIndex = _incomingBuffer.indexOf(PHONE_NUMBER_START_SEARCH_PATTERN);
 
@@ -349,6 +584,9 @@ int NB_SMS::remoteNumber(char* number, int nlength)
 
 int NB_SMS::read()
 {
+  if (_pdu) {
+    return (_rxIndex < _rxMessage.length()) ? (uint8_t)_rxMessage[_rxIndex++] : -1;
+  }
   if (*_ptrUTF8 != 0) {
     return *_ptrUTF8++;
   }
@@ -356,14 +594,9 @@ int NB_SMS::read()
     char c;
     if (_charset != SMS_CHARSET_UCS2) {
       c = _incomingBuffer[_smsDataIndex++];
-      if (_charset == SMS_CHARSET_GSM
-          && (c >= 0x80 || c <= 0x24 || (c&0x1F) == 0 || (c&0x1F) >= 0x1B)) {
-        for (auto &gsmchar : _gsmUTF8map) {
-          if (c == gsmchar.gsmc) {
-            _ptrUTF8 = gsmchar.utf8;
-            return *_ptrUTF8++;
-          }
-        }
+      if (_charset == SMS_CHARSET_GSM && (uint8_t)c < 0x80 && c != NB_GSM_ESCAPE) {
+        _ptrUTF8 = NBGsmAlphabet::toUtf8(c);
+        return *_ptrUTF8++;
       }
     } else {
       c = (HEXTONYBBLE(_incomingBuffer[_smsDataIndex+2])<<4)
@@ -390,18 +623,16 @@ int NB_SMS::read()
 
 int NB_SMS::peek()
 {
+  if (_pdu) {
+    return (_rxIndex < _rxMessage.length()) ? (uint8_t)_rxMessage[_rxIndex] : -1;
+  }
   if (*_ptrUTF8 != 0) {
     return *_ptrUTF8;
   }
   if (_smsDataIndex < (signed)_incomingBuffer.length() && _smsDataIndex <= _smsDataEndIndex) {
-    char c = _incomingBuffer[_smsDataIndex+1];
-    if (_charset == SMS_CHARSET_GSM
-        && (c >= 0x80 || c <= 0x24 || (c&0x1F) == 0 || (c&0x1F) >= 0x1B)) {
-      for (auto &gsmchar : _gsmUTF8map) {
-        if (c == gsmchar.gsmc) {
-          return gsmchar.utf8[0];
-        }
-      }
+    char c = _incomingBuffer[_smsDataIndex];
+    if (_charset == SMS_CHARSET_GSM && (uint8_t)c < 0x80 && c != NB_GSM_ESCAPE) {
+      return NBGsmAlphabet::toUtf8(c)[0];
     }
     if (_charset == SMS_CHARSET_UCS2) {
       c = (HEXTONYBBLE(_incomingBuffer[_smsDataIndex+2])<<4)
@@ -422,6 +653,24 @@ int NB_SMS::peek()
 
 void NB_SMS::flush()
 {
+  if (_pdu) {
+    // delete every part of a concatenated message
+    for (int i = 0; i < _rxNumParts; i++) {
+      while (MODEM.ready() == 0);
+
+      MODEM.sendf("AT+CMGD=%d", _rxParts[i]);
+
+      if (_synch || (i + 1) < _rxNumParts) {
+        MODEM.waitForResponse(55000);
+      }
+    }
+
+    _rxNumParts = 0;
+    _rxMessage = "";
+    _rxIndex = 0;
+    return;
+  }
+
   int smsIndexEnd = _incomingBuffer.indexOf(',');
 
   _ptrUTF8 = "";
@@ -27,6 +27,11 @@
 #define NB_SMS_CLEAR_READ_SENT_UNSENT (3)
 #define NB_SMS_CLEAR_ALL              (4)
 
+// longest concatenated message sent or received in PDU mode, in SMS
+#ifndef NB_SMS_MAX_PARTS
+#define NB_SMS_MAX_PARTS 8
+#endif
+
 class NB_SMS : public Stream {
 
 public:
@@ -47,6 +52,13 @@ public:
     */
   int setCharset(const char* charset = nullptr);
 
+  /** Select PDU mode, which sends and receives the GSM extension characters
+      and messages longer than one SMS. Text is UTF-8 in both directions and
+      the charset is not used.
+      @param enable     true for PDU mode, false for text mode (default)
+    */
+  void setPduMode(bool enable);
+
   /** Begin a SMS to send it
       @param to     Destination
       @return error command if it exists
@@ -93,7 +105,18 @@ public:
    */
   void clear(int flag = NB_SMS_CLEAR_READ_SENT);
 
+  /** Record that the modem is back in text mode, called by NB when it
+      selects the message format
+   */
+  static void reset();
+
 private:
+  int selectMode();
+  int endPduSMS();
+  int availablePdu();
+  bool nextPduMessage();
+  int nextPduEntry(int position, int& index, int& stat, int& pdu, int& pduEnd);
+
   bool _synch;
   int _state;
   String _incomingBuffer;
@@ -104,6 +127,16 @@ private:
   char _bufferUTF8[4];
   int _indexUTF8;
   const char* _ptrUTF8;
+
+  bool _pdu;
+  String _to;
+  String _txMessage;
+  String _rxMessage;
+  String _rxNumber;
+  unsigned int _rxIndex;
+  int _rxParts[NB_SMS_MAX_PARTS];
+  int _rxNumParts;
+  unsigned long _listed;
 };
 
 #endif
@@ -0,0 +1,162 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2019 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "NBGsmAlphabet.h"
+
+#define GSM_NONE 0xff
+
+// default alphabet indexed by GSM code, the escape is shown as a no-break space
+static constexpr char gsmUtf8[128][3] = {
+  "@", "£", "$", "¥", "è", "é", "ù", "ì",
+  "ò", "Ç", "\n", "Ø", "ø", "\r", "Å", "å",
+  "Δ", "_", "Φ", "Γ", "Λ", "Ω", "Π", "Ψ",
+  "Σ", "Θ", "Ξ", "\xc2\xa0", "Æ", "æ", "ß", "É",
+  " ", "!", "\"", "#", "¤", "%", "&", "'",
+  "(", ")", "*", "+", ",", "-", ".", "/",
+  "0", "1", "2", "3", "4", "5", "6", "7",
+  "8", "9", ":", ";", "<", "=", ">", "?",
+  "¡", "A", "B", "C", "D", "E", "F", "G",
+  "H", "I", "J", "K", "L", "M", "N", "O",
+  "P", "Q", "R", "S", "T", "U", "V", "W",
+  "X", "Y", "Z", "Ä", "Ö", "Ñ", "Ü", "§",
+  "¿", "a", "b", "c", "d", "e", "f", "g",
+  "h", "i", "j", "k", "l", "m", "n", "o",
+  "p", "q", "r", "s", "t", "u", "v", "w",
+  "x", "y", "z", "ä", "ö", "ñ", "ü", "à"
+};
+
+// extension table, each character is sent as the escape followed by the septet
+static constexpr struct {
+  uint8_t septet;
+  char utf8[4];
+} gsmExtensionUtf8[] = {
+  { 0x0a, "\f" },
+  { 0x14, "^" },
+  { 0x28, "{" },
+  { 0x29, "}" },
+  { 0x2f, "\\" },
+  { 0x3c, "[" },
+  { 0x3d, "~" },
+  { 0x3e, "]" },
+  { 0x40, "|" },
+  { 0x65, "€" }
+};
+
+// GSM code of every ASCII character, indexed by the character
+static constexpr uint8_t asciiGsm[128] = {
+  GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, 0x0a, GSM_NONE, 0x8a, 0x0d, GSM_NONE, GSM_NONE,
+  GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE, GSM_NONE,
+  0x20, 0x21, 0x22, 0x23, 0x02, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+  0x00, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+  0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0xbc, 0xaf, 0xbe, 0x94, 0x11,
+  GSM_NONE, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+  0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0xa8, 0xc0, 0xa9, 0xbd, GSM_NONE
+};
+
+// GSM code of the other characters, sorted by code point for a binary search
+static constexpr struct {
+  uint16_t code;
+  uint8_t gsm;
+} unicodeGsm[] = {
+  { 0x00a1, 0x40 }, { 0x00a3, 0x01 }, { 0x00a4, 0x24 }, { 0x00a5, 0x03 },
+  { 0x00a7, 0x5f }, { 0x00bf, 0x60 }, { 0x00c4, 0x5b }, { 0x00c5, 0x0e },
+  { 0x00c6, 0x1c }, { 0x00c7, 0x09 }, { 0x00c9, 0x1f }, { 0x00d1, 0x5d },
+  { 0x00d6, 0x5c }, { 0x00d8, 0x0b }, { 0x00dc, 0x5e }, { 0x00df, 0x1e },
+  { 0x00e0, 0x7f }, { 0x00e4, 0x7b }, { 0x00e5, 0x0f }, { 0x00e6, 0x1d },
+  { 0x00e8, 0x04 }, { 0x00e9, 0x05 }, { 0x00ec, 0x07 }, { 0x00f1, 0x7d },
+  { 0x00f2, 0x08 }, { 0x00f6, 0x7c }, { 0x00f8, 0x0c }, { 0x00f9, 0x06 },
+  { 0x00fc, 0x7e }, { 0x0393, 0x13 }, { 0x0394, 0x10 }, { 0x0398, 0x19 },
+  { 0x039b, 0x14 }, { 0x039e, 0x1a }, { 0x03a0, 0x16 }, { 0x03a3, 0x18 },
+  { 0x03a6, 0x12 }, { 0x03a8, 0x17 }, { 0x03a9, 0x15 }, { 0x20ac, 0xe5 }
+};
+
+const char* NBGsmAlphabet::toUtf8(uint8_t gsm)
+{
+  return gsmUtf8[gsm & 0x7f];
+}
+
+const char* NBGsmAlphabet::extensionToUtf8(uint8_t septet)
+{
+  for (size_t i = 0; i < sizeof(gsmExtensionUtf8) / sizeof(gsmExtensionUtf8[0]); i++) {
+    if (gsmExtensionUtf8[i].septet == septet) {
+      return gsmExtensionUtf8[i].utf8;
+    }
+  }
+
+  return NULL;
+}
+
+int NBGsmAlphabet::fromUnicode(uint32_t code)
+{
+  if (code < 0x80) {
+    return (asciiGsm[code] == GSM_NONE) ? -1 : asciiGsm[code];
+  }
+
+  int low = 0;
+  int high = sizeof(unicodeGsm) / sizeof(unicodeGsm[0]) - 1;
+
+  while (low <= high) {
+    int middle = (low + high) / 2;
+
+    if (unicodeGsm[middle].code == code) {
+      return unicodeGsm[middle].gsm;
+    } else if (unicodeGsm[middle].code < code) {
+      low = middle + 1;
+    } else {
+      high = middle - 1;
+    }
+  }
+
+  return -1;
+}
+
+size_t NBGsmAlphabet::decodeUtf8(const char* text, size_t length, uint32_t& code)
+{
+  uint8_t c = text[0];
+  size_t n;
+
+  if (c < 0x80) {
+    code = c;
+    return 1;
+  } else if ((c & 0xe0) == 0xc0) {
+    code = c & 0x1f;
+    n = 2;
+  } else if ((c & 0xf0) == 0xe0) {
+    code = c & 0x0f;
+    n = 3;
+  } else if ((c & 0xf8) == 0xf0) {
+    code = c & 0x07;
+    n = 4;
+  } else {
+    code = 0xfffd;
+    return 1;
+  }
+
+  for (size_t i = 1; i < n; i++) {
+    if (i >= length || (text[i] & 0xc0) != 0x80) {
+      code = 0xfffd;
+      return i;
+    }
+
+    code = (code << 6) | (text[i] & 0x3f);
+  }
+
+  return n;
+}
@@ -0,0 +1,64 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2019 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _NBGSM_ALPHABET_H_INCLUDED
+#define _NBGSM_ALPHABET_H_INCLUDED
+
+#include <Arduino.h>
+
+// escape to the extension table
+#define NB_GSM_ESCAPE   0x1b
+
+// set by fromUnicode() for characters of the extension table
+#define NB_GSM_EXTENDED 0x80
+
+/* Conversion between UTF-8 and the GSM 03.38 default alphabet and its
+   extension table. The lookup tables are constant and stay in flash.
+*/
+class NBGsmAlphabet {
+
+public:
+  /** UTF-8 text of a character of the default alphabet
+      @param gsm        GSM code, 0x00 - 0x7f
+      @return UTF-8 string of one character
+   */
+  static const char* toUtf8(uint8_t gsm);
+
+  /** UTF-8 text of a character of the extension table
+      @param septet     Septet following the escape
+      @return UTF-8 string of one character, NULL if the septet has no extension character
+   */
+  static const char* extensionToUtf8(uint8_t septet);
+
+  /** GSM code of a Unicode character
+      @param code       Unicode code point
+      @return GSM code, or NB_GSM_EXTENDED | septet for the extension table, -1 if the character has no GSM code
+   */
+  static int fromUnicode(uint32_t code);
+
+  /** Decode the first character of UTF-8 text
+      @param text       UTF-8 text
+      @param length     Text length in bytes, at least 1
+      @param code       Set to the code point, U+FFFD for invalid sequences
+      @return number of bytes used
+   */
+  static size_t decodeUtf8(const char* text, size_t length, uint32_t& code);
+};
+
+#endif
@@ -0,0 +1,434 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2019 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "NBGsmAlphabet.h"
+
+#include "NBSmsPdu.h"
+
+// user data sizes of one SMS, and of one part of a concatenated SMS
+#define SMS_SEPTETS         160
+#define SMS_OCTETS          140
+#define SMS_CONCAT_HEADER   6
+#define SMS_MAX_DIGITS      20
+
+static int hexValue(char c)
+{
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  } else if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  } else if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+
+  return -1;
+}
+
+int NBSmsPdu::encoding(const char* text, size_t length)
+{
+  size_t pos = 0;
+
+  while (pos < length) {
+    uint32_t code;
+
+    pos += NBGsmAlphabet::decodeUtf8(text + pos, length - pos, code);
+
+    if (NBGsmAlphabet::fromUnicode(code) == -1) {
+      return NB_SMS_PDU_UCS2;
+    }
+  }
+
+  return NB_SMS_PDU_7BIT;
+}
+
+int NBSmsPdu::parts(const char* text, size_t length, int encoding)
+{
+  size_t units;
+
+  if (fill(text, length, encoding, (encoding == NB_SMS_PDU_7BIT) ? SMS_SEPTETS : SMS_OCTETS, NULL, units) == length) {
+    return 1;
+  }
+
+  // the concatenation header takes 7 septets or 6 octets of every part
+  size_t capacity = (encoding == NB_SMS_PDU_7BIT) ? (SMS_SEPTETS - 7) : (SMS_OCTETS - SMS_CONCAT_HEADER);
+  size_t pos = 0;
+  int count = 0;
+
+  while (pos < length) {
+    pos += fill(text + pos, length - pos, encoding, capacity, NULL, units);
+    count++;
+  }
+
+  return count;
+}
+
+size_t NBSmsPdu::encodeSubmit(uint8_t* pdu, const char* to, const char* text, size_t length, int encoding, int reference, int part, int total, size_t& consumed)
+{
+  uint8_t digits[SMS_MAX_DIGITS];
+  size_t numDigits = 0;
+  uint8_t toa = 0x81;
+  size_t n = 0;
+
+  if (*to == '+') {
+    toa = 0x91;
+    to++;
+  }
+
+  for (; *to && numDigits < SMS_MAX_DIGITS; to++) {
+    if (*to >= '0' && *to <= '9') {
+      digits[numDigits++] = *to - '0';
+    } else if (*to == '*') {
+      digits[numDigits++] = 0x0a;
+    } else if (*to == '#') {
+      digits[numDigits++] = 0x0b;
+    }
+  }
+
+  pdu[n++] = 0x00; // use the SMSC stored in the SIM
+  pdu[n++] = (total > 1) ? 0x41 : 0x01; // SMS-SUBMIT, with a user data header for concatenation
+  pdu[n++] = 0x00; // message reference, set by the modem
+  pdu[n++] = numDigits;
+  pdu[n++] = toa;
+
+  for (size_t i = 0; i < numDigits; i += 2) {
+    pdu[n++] = (((i + 1) < numDigits ? digits[i + 1] : 0x0f) << 4) | digits[i];
+  }
+
+  pdu[n++] = 0x00; // protocol identifier
+  pdu[n++] = (encoding == NB_SMS_PDU_UCS2) ? 0x08 : 0x00;
+
+  size_t udl = n++;
+  size_t headerOctets = 0;
+
+  if (total > 1) {
+    pdu[n++] = SMS_CONCAT_HEADER - 1;
+    pdu[n++] = 0x00; // concatenated short message, 8 bit reference
+    pdu[n++] = 0x03;
+    pdu[n++] = reference;
+    pdu[n++] = total;
+    pdu[n++] = part;
+
+    headerOctets = SMS_CONCAT_HEADER;
+  }
+
+  size_t units;
+
+  if (encoding == NB_SMS_PDU_7BIT) {
+    // the text starts on the first septet boundary after the header
+    size_t headerSeptets = (headerOctets * 8 + 6) / 7;
+    int fillBits = headerSeptets * 7 - headerOctets * 8;
+    uint8_t septets[SMS_SEPTETS];
+
+    consumed = fill(text, length, encoding, SMS_SEPTETS - headerSeptets, septets, units);
+    packSeptets(septets, units, &pdu[n], fillBits);
+
+    n += (fillBits + units * 7 + 7) / 8;
+    pdu[udl] = headerSeptets + units;
+  } else {
+    consumed = fill(text, length, encoding, SMS_OCTETS - headerOctets, &pdu[n], units);
+
+    n += units;
+    pdu[udl] = headerOctets + units;
+  }
+
+  return n;
+}
+
+bool NBSmsPdu::decodeDeliver(const char* hex, size_t hexLength, String& sender, String* text, NBSmsConcat& concat)
+{
+  uint8_t pdu[NB_SMS_PDU_MAX_DELIVER_SIZE];
+  size_t size = hexLength / 2;
+
+  if (size > sizeof(pdu)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    int high = hexValue(hex[i * 2]);
+    int low = hexValue(hex[i * 2 + 1]);
+
+    if (high == -1 || low == -1) {
+      return false;
+    }
+
+    pdu[i] = (high << 4) | low;
+  }
+
+  // SMSC address
+  size_t i = 1;
+
+  if (size < 1 || (i += pdu[0]) + 3 > size) {
+    return false;
+  }
+
+  uint8_t first = pdu[i++];
+
+  if ((first & 0x03) != 0x00) {
+    // not a SMS-DELIVER
+    return false;
+  }
+
+  size_t digits = pdu[i++];
+  uint8_t toa = pdu[i++];
+
+  if (i + (digits + 1) / 2 + 10 > size) {
+    return false;
+  }
+
+  sender = "";
+
+  if ((toa & 0x70) == 0x50) {
+    // alphanumeric sender, digits counts the semi-octets used by the packed name
+    appendSeptets(sender, &pdu[i], 0, digits * 4 / 7);
+  } else {
+    if ((toa & 0x70) == 0x10) {
+      sender += '+';
+    }
+
+    for (size_t d = 0; d < digits; d++) {
+      sender += "0123456789*#abc?"[(pdu[i + d / 2] >> ((d & 1) * 4)) & 0x0f];
+    }
+  }
+
+  i += (digits + 1) / 2;
+  i++; // protocol identifier
+
+  uint8_t dcs = pdu[i++];
+  int alphabet;
+
+  i += 7; // service centre time stamp
+
+  size_t udl = pdu[i++];
+  const uint8_t* ud = &pdu[i];
+
+  // 0 = GSM 7 bit, 1 = 8 bit data, 2 = UCS2
+  if ((dcs & 0xc0) == 0x00) {
+    alphabet = (dcs >> 2) & 0x03;
+  } else if ((dcs & 0xf0) == 0xf0) {
+    alphabet = (dcs & 0x04) ? 1 : 0;
+  } else if ((dcs & 0xf0) == 0xe0) {
+    alphabet = 2;
+  } else {
+    alphabet = 0;
+  }
+
+  if (alphabet == 3) {
+    alphabet = 0;
+  }
+
+  if (((alphabet == 0) ? (udl * 7 + 7) / 8 : udl) > size - i) {
+    return false;
+  }
+
+  size_t header = 0;
+
+  concat.reference = 0;
+  concat.total = 1;
+  concat.sequence = 1;
+
+  if (first & 0x40) {
+    header = ud[0] + 1;
+
+    if (header > ((alphabet == 0) ? (udl * 7 / 8) : udl)) {
+      return false;
+    }
+
+    for (size_t h = 1; h + 1 < header; h += 2 + ud[h + 1]) {
+      uint8_t iei = ud[h];
+      size_t ieLength = ud[h + 1];
+
+      if (h + 2 + ieLength > header) {
+        break;
+      }
+
+      if (iei == 0x00 && ieLength == 3) {
+        concat.reference = ud[h + 2];
+        concat.total = ud[h + 3];
+        concat.sequence = ud[h + 4];
+      } else if (iei == 0x08 && ieLength == 4) {
+        concat.reference = (ud[h + 2] << 8) | ud[h + 3];
+        concat.total = ud[h + 4];
+        concat.sequence = ud[h + 5];
+      }
+    }
+
+    if (concat.total < 1 || concat.sequence < 1 || concat.sequence > concat.total) {
+      concat.reference = 0;
+      concat.total = 1;
+      concat.sequence = 1;
+    }
+  }
+
+  if (text == NULL) {
+    return true;
+  }
+
+  if (alphabet == 0) {
+    appendSeptets(*text, ud, (header * 8 + 6) / 7, udl);
+  } else if (alphabet == 2) {
+    for (size_t j = header; j + 1 < udl; j += 2) {
+      uint32_t code = (ud[j] << 8) | ud[j + 1];
+
+      if ((code & 0xfc00) == 0xd800 && j + 3 < udl && (ud[j + 2] & 0xfc) == 0xdc) {
+        code = 0x10000 + ((code & 0x3ff) << 10) + (((ud[j + 2] & 0x03) << 8) | ud[j + 3]);
+        j += 2;
+      }
+
+      appendUtf8(*text, code);
+    }
+  } else {
+    for (size_t j = header; j < udl; j++) {
+      appendUtf8(*text, ud[j]);
+    }
+  }
+
+  return true;
+}
+
+size_t NBSmsPdu::fill(const char* text, size_t length, int encoding, size_t capacity, uint8_t* out, size_t& units)
+{
+  size_t pos = 0;
+
+  units = 0;
+
+  while (pos < length) {
+    uint32_t code;
+    size_t n = NBGsmAlphabet::decodeUtf8(text + pos, length - pos, code);
+
+    if (encoding == NB_SMS_PDU_7BIT) {
+      int gsm = NBGsmAlphabet::fromUnicode(code);
+
+      if (gsm == -1) {
+        gsm = '?';
+      }
+
+      size_t need = (gsm & NB_GSM_EXTENDED) ? 2 : 1;
+
+      // an escape sequence is never split over two parts
+      if (units + need > capacity) {
+        break;
+      }
+
+      if (out) {
+        if (need == 2) {
+          out[units] = NB_GSM_ESCAPE;
+        }
+        out[units + need - 1] = gsm & 0x7f;
+      }
+
+      units += need;
+    } else {
+      size_t need = (code > 0xffff) ? 4 : 2;
+
+      // neither is a surrogate pair
+      if (units + need > capacity) {
+        break;
+      }
+
+      if (out) {
+        if (need == 4) {
+          uint32_t high = 0xd800 | ((code - 0x10000) >> 10);
+          uint32_t low = 0xdc00 | (code & 0x3ff);
+
+          out[units] = high >> 8;
+          out[units + 1] = high & 0xff;
+          out[units + 2] = low >> 8;
+          out[units + 3] = low & 0xff;
+        } else {
+          out[units] = code >> 8;
+          out[units + 1] = code & 0xff;
+        }
+      }
+
+      units += need;
+    }
+
+    pos += n;
+  }
+
+  return pos;
+}
+
+void NBSmsPdu::appendUtf8(String& text, uint32_t code)
+{
+  if (code < 0x80) {
+    text += (char)code;
+  } else if (code < 0x800) {
+    text += (char)(0xc0 | (code >> 6));
+    text += (char)(0x80 | (code & 0x3f));
+  } else if (code < 0x10000) {
+    text += (char)(0xe0 | (code >> 12));
+    text += (char)(0x80 | ((code >> 6) & 0x3f));
+    text += (char)(0x80 | (code & 0x3f));
+  } else {
+    text += (char)(0xf0 | (code >> 18));
+    text += (char)(0x80 | ((code >> 12) & 0x3f));
+    text += (char)(0x80 | ((code >> 6) & 0x3f));
+    text += (char)(0x80 | (code & 0x3f));
+  }
+}
+
+void NBSmsPdu::packSeptets(const uint8_t* septets, size_t count, uint8_t* out, int fillBits)
+{
+  size_t bit = fillBits;
+
+  memset(out, 0x00, (fillBits + count * 7 + 7) / 8);
+
+  for (size_t i = 0; i < count; i++, bit += 7) {
+    uint16_t value = (septets[i] & 0x7f) << (bit % 8);
+
+    out[bit / 8] |= value & 0xff;
+
+    if ((bit % 8) > 1) {
+      out[bit / 8 + 1] |= value >> 8;
+    }
+  }
+}
+
+uint8_t NBSmsPdu::septetAt(const uint8_t* data, size_t index)
+{
+  size_t bit = index * 7;
+  uint16_t value = data[bit / 8] >> (bit % 8);
+
+  if ((bit % 8) > 1) {
+    value |= data[bit / 8 + 1] << (8 - (bit % 8));
+  }
+
+  return value & 0x7f;
+}
+
+void NBSmsPdu::appendSeptets(String& text, const uint8_t* data, size_t start, size_t end)
+{
+  for (size_t i = start; i < end; i++) {
+    uint8_t septet = septetAt(data, i);
+
+    if (septet == NB_GSM_ESCAPE) {
+      if (i + 1 < end) {
+        septet = septetAt(data, ++i);
+
+        // unknown extension characters are shown as the basic character
+        const char* extension = NBGsmAlphabet::extensionToUtf8(septet);
+
+        text += (extension != NULL) ? extension : NBGsmAlphabet::toUtf8(septet);
+      }
+    } else {
+      text += NBGsmAlphabet::toUtf8(septet);
+    }
+  }
+}
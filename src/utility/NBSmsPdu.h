@@ -0,0 +1,98 @@
+/*
+  This file is part of the MKR NB library.
+  Copyright (c) 2019 Arduino SA. All rights reserved.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _NBSMS_PDU_H_INCLUDED
+#define _NBSMS_PDU_H_INCLUDED
+
+#include <Arduino.h>
+
+enum {
+  NB_SMS_PDU_7BIT,
+  NB_SMS_PDU_UCS2
+};
+
+// largest SMS-SUBMIT built by encodeSubmit(), including the empty SMSC field
+#define NB_SMS_PDU_MAX_SIZE 160
+
+// largest SMS-DELIVER accepted by decodeDeliver(), including the SMSC field
+#define NB_SMS_PDU_MAX_DELIVER_SIZE 176
+
+struct NBSmsConcat {
+  int reference;
+  int total;
+  int sequence;
+};
+
+/* Encoder and decoder for the 3GPP TS 23.040 PDUs used by AT+CMGS and
+   AT+CMGL in PDU mode (AT+CMGF=0). Text is UTF-8 on the library side and
+   is sent in the GSM 7 bit alphabet, including the extension table, when
+   every character has a GSM code, or as UCS2 otherwise. Messages that do
+   not fit in one SMS are split into parts carrying a concatenation header.
+*/
+class NBSmsPdu {
+
+public:
+  /** Select the alphabet a message is sent with
+      @param text       UTF-8 text
+      @param length     Text length in bytes
+      @return NB_SMS_PDU_7BIT or NB_SMS_PDU_UCS2
+   */
+  static int encoding(const char* text, size_t length);
+
+  /** Number of SMS needed to send a message
+      @param text       UTF-8 text
+      @param length     Text length in bytes
+      @param encoding   Alphabet returned by encoding()
+      @return number of parts
+   */
+  static int parts(const char* text, size_t length, int encoding);
+
+  /** Build the SMS-SUBMIT PDU of one part of a message
+      @param pdu        Buffer of NB_SMS_PDU_MAX_SIZE bytes for the PDU
+      @param to         Destination number, international if it starts with '+'
+      @param text       UTF-8 text still to send
+      @param length     Text length in bytes
+      @param encoding   Alphabet returned by encoding()
+      @param reference  Concatenation reference shared by all the parts
+      @param part       Part number, starting at 1
+      @param total      Number of parts returned by parts()
+      @param consumed   Set to the number of text bytes sent in this part
+      @return PDU size in bytes, AT+CMGS takes this size minus 1
+   */
+  static size_t encodeSubmit(uint8_t* pdu, const char* to, const char* text, size_t length, int encoding, int reference, int part, int total, size_t& consumed);
+
+  /** Decode a SMS-DELIVER PDU listed by AT+CMGL
+      @param hex        PDU in hex
+      @param hexLength  Number of hex digits
+      @param sender     Set to the originating address
+      @param text       Decoded UTF-8 text is appended to it, may be NULL
+      @param concat     Set to the concatenation header, total is 1 for a single SMS
+      @return true on success, false if the PDU is not a valid SMS-DELIVER
+   */
+  static bool decodeDeliver(const char* hex, size_t hexLength, String& sender, String* text, NBSmsConcat& concat);
+
+private:
+  static size_t fill(const char* text, size_t length, int encoding, size_t capacity, uint8_t* out, size_t& units);
+  static void appendUtf8(String& text, uint32_t code);
+  static void packSeptets(const uint8_t* septets, size_t count, uint8_t* out, int fillBits);
+  static uint8_t septetAt(const uint8_t* data, size_t index);
+  static void appendSeptets(String& text, const uint8_t* data, size_t start, size_t end);
+};
+
+#endif
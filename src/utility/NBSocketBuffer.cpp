@@ -26,45 +26,115 @@
 
 #define NB_SOCKET_NUM_BUFFERS (sizeof(_buffers) / sizeof(_buffers[0]))
 
-#define NB_SOCKET_BUFFER_SIZE 512
-
-NBSocketBufferClass::NBSocketBufferClass()
+NBSocketBufferClass::NBSocketBufferClass() :
+  _hexMode(false),
+  _writeChunkSize(0),
+  _readChunkSize(0)
 {
   memset(&_buffers, 0x00, sizeof(_buffers));
+
+  MODEM.addUrcHandler(this);
 }
 
 NBSocketBufferClass::~NBSocketBufferClass()
 {
+  MODEM.removeUrcHandler(this);
+
   for (unsigned int i = 0; i < NB_SOCKET_NUM_BUFFERS; i++) {
-    close(i);
+    releaseData(i);
   }
 }
 
+void NBSocketBufferClass::open(int socket)
+{
+  releaseData(socket);
+
+  _buffers[socket].pending = 0;
+  _buffers[socket].state = NB_SOCKET_STATE_OPEN;
+}
+
 void NBSocketBufferClass::close(int socket)
+{
+  releaseData(socket);
+
+  _buffers[socket].pending = 0;
+  _buffers[socket].state = NB_SOCKET_STATE_UNKNOWN;
+}
+
+void NBSocketBufferClass::releaseData(int socket)
 {
   if (_buffers[socket].data) {
     free(_buffers[socket].data);
     _buffers[socket].data = _buffers[socket].head = NULL;
     _buffers[socket].length = 0;
+    _buffers[socket].size = 0;
+  }
+}
+
+void NBSocketBufferClass::setChunkSize(size_t writeSize, size_t readSize)
+{
+  _writeChunkSize = writeSize;
+  _readChunkSize = readSize;
+}
+
+void NBSocketBufferClass::setHexMode(bool hexMode)
+{
+  _hexMode = hexMode;
+}
+
+size_t NBSocketBufferClass::writeChunkSize()
+{
+  size_t maxSize = _hexMode ? NB_SOCKET_HEX_MODE_WRITE_CHUNK_SIZE : NB_SOCKET_DEFAULT_WRITE_CHUNK_SIZE;
+
+  if (_writeChunkSize == 0 || _writeChunkSize > maxSize) {
+    return maxSize;
   }
+
+  return _writeChunkSize;
+}
+
+size_t NBSocketBufferClass::readChunkSize()
+{
+  size_t maxSize = _hexMode ? NB_SOCKET_HEX_MODE_READ_CHUNK_SIZE : NB_SOCKET_DEFAULT_READ_CHUNK_SIZE;
+
+  if (_readChunkSize == 0 || _readChunkSize > maxSize) {
+    return maxSize;
+  }
+
+  return _readChunkSize;
 }
 
 int NBSocketBufferClass::available(int socket)
 {
   if (_buffers[socket].length == 0) {
+    if (_buffers[socket].state == NB_SOCKET_STATE_CLOSED && _buffers[socket].pending == 0) {
+      // closed and drained, no need to ask the modem
+      return -1;
+    }
+
+    size_t chunkSize = readChunkSize();
+
+    if (_buffers[socket].size < chunkSize) {
+      // (re)allocate, the read size might have grown since the last read
+      releaseData(socket);
+    }
+
     if (_buffers[socket].data == NULL) {
-      _buffers[socket].data = _buffers[socket].head = (uint8_t*)malloc(NB_SOCKET_BUFFER_SIZE);
+      _buffers[socket].data = _buffers[socket].head = (uint8_t*)malloc(chunkSize);
       _buffers[socket].length = 0;
+      _buffers[socket].size = chunkSize;
     }
 
     String response;
 
-    MODEM.sendf("AT+USORD=%d,%d", socket, NB_SOCKET_BUFFER_SIZE);
+    MODEM.sendf("AT+USORD=%d,%d", socket, (int)chunkSize);
     int status = MODEM.waitForResponse(10000, &response);
     if (status != 1) {
       if (status == 2) {
+        _buffers[socket].state = NB_SOCKET_STATE_CLOSED;
         return -1;
       } else if (status == 4 && response.indexOf("Operation not allowed") != -1 ) {
+        _buffers[socket].state = NB_SOCKET_STATE_CLOSED;
         return -1;
       } else {
         return 0;
@@ -82,6 +152,10 @@ int NBSocketBufferClass::available(int socket)
 
     size_t size = response.length() / 2;
 
+    if (size > _buffers[socket].size) {
+      size = _buffers[socket].size;
+    }
+
     for (size_t i = 0; i < size; i++) {
       byte n1 = response[i * 2];
       byte n2 = response[i * 2 + 1];
@@ -103,6 +177,13 @@ int NBSocketBufferClass::available(int socket)
 
     _buffers[socket].head = _buffers[socket].data;
     _buffers[socket].length = size;
+
+    if (size == 0) {
+      // nothing left in the modem, the last URC is stale
+      _buffers[socket].pending = 0;
+    } else {
+      consumed(socket, size);
+    }
   }
 
   return _buffers[socket].length;
@@ -136,4 +217,161 @@ int NBSocketBufferClass::read(int socket, uint8_t* data, size_t length)
   return length;
 }
 
+bool NBSocketBufferClass::readable(int socket)
+{
+  return (_buffers[socket].length > 0 || _buffers[socket].pending > 0);
+}
+
+bool NBSocketBufferClass::closed(int socket)
+{
+  return (_buffers[socket].state == NB_SOCKET_STATE_CLOSED);
+}
+
+int NBSocketBufferClass::state(int socket)
+{
+  return _buffers[socket].state;
+}
+
+void NBSocketBufferClass::setState(int socket, int state)
+{
+  _buffers[socket].state = state;
+}
+
+int NBSocketBufferClass::refreshState(int socket)
+{
+  switch (control(socket, 1)) {
+    case -1: // the modem does not know this socket
+      _buffers[socket].state = NB_SOCKET_STATE_CLOSED;
+      break;
+
+    case 2: // SYN_SENT
+    case 3: // SYN_RCVD
+      _buffers[socket].state = NB_SOCKET_STATE_OPEN;
+      break;
+
+    case 1: // LISTEN
+    case 4: // ESTABLISHED
+      _buffers[socket].state = NB_SOCKET_STATE_CONNECTED;
+      break;
+
+    default:
+      _buffers[socket].state = NB_SOCKET_STATE_CLOSED;
+      break;
+  }
+
+  return _buffers[socket].state;
+}
+
+long NBSocketBufferClass::control(int socket, int param)
+{
+  String response;
+
+  MODEM.sendf("AT+USOCTL=%d,%d", socket, param);
+  if (MODEM.waitForResponse(10000, &response) != 1) {
+    return -1;
+  }
+
+  // +USOCTL: <socket>,<param>,<value>
+  if (!response.startsWith("+USOCTL: ")) {
+    return -1;
+  }
+
+  return response.substring(response.lastIndexOf(',') + 1).toInt();
+}
+
+void NBSocketBufferClass::stats(int socket, NBSocketStats& stats, bool query, bool tcp)
+{
+  stats.bytesSent = 0;
+  stats.bytesReceived = 0;
+  stats.bytesAcked = 0;
+
+  if (query && socket >= 0) {
+    long sent = control(socket, 2);
+    long received = control(socket, 3);
+
+    if (sent > 0) {
+      stats.bytesSent = sent;
+    }
+
+    if (received > 0) {
+      stats.bytesReceived = received;
+    }
+
+    if (tcp) {
+      long unacked = control(socket, 11);
+
+      if (unacked >= 0 && unacked <= sent) {
+        stats.bytesAcked = sent - unacked;
+      }
+    }
+  }
+
+  // read last so that the queries above are included
+  stats.commands = MODEM.commandCount();
+  stats.uartBytes = MODEM.uartByteCount();
+  stats.waitTime = MODEM.waitTime();
+}
+
+void NBSocketBufferClass::clearPending(int socket)
+{
+  _buffers[socket].pending = 0;
+}
+
+void NBSocketBufferClass::consumed(int socket, size_t length)
+{
+  if (length < _buffers[socket].pending) {
+    _buffers[socket].pending -= length;
+  } else {
+    _buffers[socket].pending = 0;
+  }
+}
+
+void NBSocketBufferClass::handleUrc(const String& urc)
+{
+  if (urc.startsWith("+UUSOCO: ")) {
+    int socket = urc.charAt(9) - '0';
+
+    if (socket < 0 || socket >= (int)NB_SOCKET_NUM_BUFFERS) {
+      return;
+    }
+
+    // +UUSOCO: <socket>,<socket_error>
+    if (urc.substring(urc.indexOf(',') + 1).toInt() == 0) {
+      _buffers[socket].state = NB_SOCKET_STATE_CONNECTED;
+    } else {
+      _buffers[socket].state = NB_SOCKET_STATE_CLOSED;
+    }
+  } else if (urc.startsWith("+UUSORD: ") || urc.startsWith("+UUSORF: ")) {
+    int socket = urc.charAt(9) - '0';
+
+    if (socket < 0 || socket >= (int)NB_SOCKET_NUM_BUFFERS) {
+      return;
+    }
+
+    if (urc.endsWith(",4294967295")) {
+      _buffers[socket].state = NB_SOCKET_STATE_CLOSED;
+    } else if (urc.startsWith("+UUSORD: ")) {
+      // the length is the total amount of data waiting in the modem
+      _buffers[socket].pending = urc.substring(urc.indexOf(',') + 1).toInt();
+    } else {
+      // count every datagram, overcounting only costs one empty AT+USORF
+      _buffers[socket].pending += urc.substring(urc.indexOf(',') + 1).toInt();
+    }
+  } else if (urc.startsWith("+UUSOLI: ")) {
+    // a listening socket accepted a connection on a new socket
+    int socket = urc.charAt(9) - '0';
+
+    if (socket >= 0 && socket < (int)NB_SOCKET_NUM_BUFFERS) {
+      open(socket);
+      _buffers[socket].state = NB_SOCKET_STATE_CONNECTED;
+    }
+  } else if (urc.startsWith("+UUSOCL: ")) {
+    int socket = urc.charAt(urc.length() - 1) - '0';
+
+    if (socket >= 0 && socket < (int)NB_SOCKET_NUM_BUFFERS) {
+      _buffers[socket].state = NB_SOCKET_STATE_CLOSED;
+    }
+  }
+}
+
 NBSocketBufferClass NBSocketBuffer;
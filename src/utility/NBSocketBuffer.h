@@ -20,25 +20,104 @@
 #ifndef _NBSOCKET_BUFFER_H_INCLUDED
 #define _NBSOCKET_BUFFER_H_INCLUDED
 
-class NBSocketBufferClass {
+#include "Modem.h"
+
+// conservative AT+USOWR/AT+USORD payload sizes, used until hex mode is confirmed
+#define NB_SOCKET_DEFAULT_WRITE_CHUNK_SIZE 256
+#define NB_SOCKET_DEFAULT_READ_CHUNK_SIZE  512
+
+// AT+USOWR/AT+USORD hex payload limits of the SARA-R4 firmware (AT commands
+// manual), the modem does not report them so they cannot be queried at run time
+#define NB_SOCKET_HEX_MODE_WRITE_CHUNK_SIZE 512
+#define NB_SOCKET_HEX_MODE_READ_CHUNK_SIZE  1024
+
+enum {
+  NB_SOCKET_STATE_UNKNOWN,
+  NB_SOCKET_STATE_OPEN,
+  NB_SOCKET_STATE_CONNECTED,
+  NB_SOCKET_STATE_CLOSED
+};
+
+struct NBSocketStats {
+  // reported by the modem with AT+USOCTL
+  unsigned long bytesSent;
+  unsigned long bytesReceived;
+  unsigned long bytesAcked;   // TCP only
+
+  // counted by the library for the whole modem
+  unsigned long commands;     // AT commands sent
+  unsigned long uartBytes;    // UART traffic in both directions, hex encoding included
+  unsigned long waitTime;     // ms spent blocked in waitForResponse
+};
+
+class NBSocketBufferClass : public ModemUrcHandler {
 
-public:
 public:
   NBSocketBufferClass();
   virtual ~NBSocketBufferClass();
 
+  void open(int socket);
   void close(int socket);
 
+  /** Limit the payload size of AT+USOWR and AT+USORD transactions
+      @param writeSize   Bytes per write, 0 for the maximum of the active data mode
+      @param readSize    Bytes per read, 0 for the maximum of the active data mode
+   */
+  void setChunkSize(size_t writeSize = 0, size_t readSize = 0);
+  void setHexMode(bool hexMode);
+
+  size_t writeChunkSize();
+  size_t readChunkSize();
+
   int available(int socket);
   int peek(int socket);
   int read(int socket, uint8_t* data, size_t length);
 
+  /** Socket state as reported by the +UUSOCO, +UUSORD, +UUSORF and +UUSOCL
+      URCs, these do not send any AT command
+   */
+  bool readable(int socket);
+  bool closed(int socket);
+  int state(int socket);
+  void setState(int socket, int state);
+  void consumed(int socket, size_t length);
+  void clearPending(int socket);
+
+  /** Query the state of a socket the URCs have not told anything
+      about yet, sends AT+USOCTL=<socket>,1
+      @return socket state
+   */
+  int refreshState(int socket);
+
+  /** Query a socket control parameter with AT+USOCTL
+      @return parameter value, -1 on error
+   */
+  long control(int socket, int param);
+
+  /** Fill in the traffic counters of a socket
+      @param query   Ask the modem for the socket counters (one AT+USOCTL
+                     per value), the library counters are always filled in
+      @param tcp     Also query the unacknowledged byte count
+   */
+  void stats(int socket, NBSocketStats& stats, bool query, bool tcp);
+
+  virtual void handleUrc(const String& urc);
+
 private:
+  void releaseData(int socket);
+
   struct {
     uint8_t* data;
     uint8_t* head;
     int length;
+    size_t size;
+    size_t pending;
+    int state;
   } _buffers[7];
+
+  bool _hexMode;
+  size_t _writeChunkSize;
+  size_t _readChunkSize;
 };
 
 extern NBSocketBufferClass NBSocketBuffer;